@@ -0,0 +1,62 @@
+//============================================================================
+//                                  I B E X
+// File        : arith04.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <time.h>
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Benchmark of the batched power x^p on interval vectors
+ * against the component-wise application of the scalar power.
+ */
+
+#define BENCH(name,fx,fxi) { \
+	clock_t start=clock(); \
+	for (int r=0; r<nb_runs; r++) { \
+		IntervalVector y(n); \
+		for (int i=0; i<n; i++) y[i]=fxi; \
+		sink+=y[n/2].ub(); \
+	} \
+	double t_scalar=((double)(clock()-start))/CLOCKS_PER_SEC; \
+	start=clock(); \
+	for (int r=0; r<nb_runs; r++) { \
+		IntervalVector y=fx; \
+		sink+=y[n/2].ub(); \
+	} \
+	double t_batch=((double)(clock()-start))/CLOCKS_PER_SEC; \
+	cout << name << "\tscalar=" << t_scalar << "s\tbatch=" << t_batch << "s" << endl; \
+}
+
+int main() {
+
+	int n=100000;
+	int nb_runs=20;
+	double sink=0;
+
+	IntervalVector x(n);
+	srand(1);
+	for (int i=0; i<n; i++) {
+		double l=0.5+10.0*rand()/RAND_MAX;
+		x[i]=Interval(l,l+1e-3*rand()/RAND_MAX);
+	}
+
+	cout << "vectors of size " << n << " (" << nb_runs << " runs)" << endl;
+
+	BENCH("pow(x,2)", pow(x,2),   pow(x[i],2));
+	BENCH("pow(x,3)", pow(x,3),   pow(x[i],3));
+	BENCH("pow(x,7)", pow(x,7),   pow(x[i],7));
+
+	if (sink==0) cout << endl; // prevents the optimizer to remove the loops
+
+	return 0;
+}
@@ -0,0 +1,109 @@
+//============================================================================
+//                                  I B E X
+// File        : ctc03.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <time.h>
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Comparison of CtcHC4 (one forward-backward contractor
+ * per constraint) with CtcFusedHC4 (one DAG for the whole system).
+ *
+ * The system is solved with both contractors (round-robin bisection,
+ * depth-first search) and the number of DAG nodes evaluated per
+ * fixpoint is reported.
+ *
+ * Usage: ctc03 file.bch [precision] [time limit]
+ */
+
+/*
+ * Counts the nodes evaluated by the forward-backward
+ * contractors of CtcHC4.
+ */
+class CtcCount : public CtcFwdBwd {
+public:
+	CtcCount(const NumConstraint& ctr, long& nb_nodes) : CtcFwdBwd(ctr), nb_nodes(nb_nodes) { }
+
+	void contract(IntervalVector& box) {
+		nb_nodes+=f.nb_nodes();
+		CtcFwdBwd::contract(box);
+	}
+
+	long& nb_nodes;
+};
+
+/*
+ * Counts the number of fixpoints.
+ */
+class CtcFix : public Ctc {
+public:
+	CtcFix(Ctc& c) : Ctc(c.nb_var), c(c), nb_calls(0) { }
+
+	void contract(IntervalVector& box) {
+		nb_calls++;
+		c.contract(box);
+	}
+
+	Ctc& c;
+	long nb_calls;
+};
+
+void report(const char* name, Solver& s, double time, long nb_nodes, long nb_fix, int nb_sols) {
+	cout << name << "\tsols=" << nb_sols << "\tcells=" << s.nb_cells
+		 << "\tnodes/fixpoint=" << ((double) nb_nodes)/nb_fix << "\ttime=" << time << "s" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	if (argc<2) {
+		cerr << "usage: ctc03 file.bch [precision] [time limit]" << endl;
+		exit(1);
+	}
+
+	System sys(argv[1]);
+	double prec=argc>2? atof(argv[2]) : 1e-6;
+	double time_limit=argc>3? atof(argv[3]) : 60;
+
+	// ============== HC4 ===================
+	long nb_nodes=0;
+	Array<Ctc> l(sys.nb_ctr);
+	for (int i=0; i<sys.nb_ctr; i++)
+		l.set_ref(i,*new CtcCount(sys.ctrs[i],nb_nodes));
+	CtcPropag hc4(l);
+	CtcFix fix1(hc4);
+	RoundRobin rr1(prec);
+	CellStack buff1;
+	Solver s1(fix1,rr1,buff1);
+	s1.time_limit=time_limit;
+
+	clock_t start=clock();
+	int nb_sols=s1.solve(sys.box).size();
+	report("HC4      ",s1,((double)(clock()-start))/CLOCKS_PER_SEC,nb_nodes,fix1.nb_calls,nb_sols);
+
+	for (int i=0; i<sys.nb_ctr; i++)
+		delete &l[i];
+
+	// ============== Fused HC4 ===================
+	CtcFusedHC4 fused(sys);
+	CtcFix fix2(fused);
+	RoundRobin rr2(prec);
+	CellStack buff2;
+	Solver s2(fix2,rr2,buff2);
+	s2.time_limit=time_limit;
+
+	start=clock();
+	nb_sols=s2.solve(sys.box).size();
+	report("Fused HC4",s2,((double)(clock()-start))/CLOCKS_PER_SEC,fused.nb_evals,fix2.nb_calls,nb_sols);
+
+	return 0;
+}
@@ -77,7 +77,7 @@ int main() {
 	IntervalVector box(N,_box);
 	
 	// The q-intersection of the P contractors
-	CtcQInterProjF ctcq(m_ctc,Q);
+	CtcQInter ctcq(m_ctc,Q,CtcQInter::QINTER_PROJ);
 
 	// Fixpoint
 	CtcFixPoint fix(ctcq);
@@ -133,7 +133,7 @@ int main() {
 	
 	pendingList.push_back(box);
 	
-	CtcQInterProjF ctcq(m_ctc,Q);
+	CtcQInter ctcq(m_ctc,Q,CtcQInter::QINTER_PROJ);
 	CtcFixPoint ctcf(ctcq);
 
 	int counter = 0;
@@ -98,9 +98,9 @@ int main() {
 		
 	IntervalVector box(N,_box);
 	
-	/* use CtcQInterProjF ctcq(m_ctc,Q)
+	/* use CtcQInter ctcq(m_ctc,Q,CtcQInter::QINTER_PROJ)
 	 * for projective filtering */
-	CtcQInterCoreF ctcq(m_ctc,Q);
+	CtcQInter ctcq(m_ctc,Q,CtcQInter::QINTER_SWEEP);
 	CtcFixPoint fix(ctcq);
 	
 	list<IntervalVector> pendingList;
@@ -22,6 +22,7 @@
 #include "ibex_Affine2_iAF.h"
 #include "ibex_Affine2_fAF2_fma.h"
 #include "ibex_Affine2_sAF.h"
+#include "ibex_Affine2_sfAF2.h"
 #include "ibex_Affine2_No.h"
 
 
@@ -42,6 +43,7 @@ class Affine2MatrixArray;
 
 //typedef AF_fAF1  AF_Default;
 typedef AF_fAF2  AF_Default;
+//typedef AF_sfAF2  AF_Default;
 //typedef AF_fAF2_fma  AF_Default;
 //typedef AF_iAF  AF_Default;
 //typedef AF_sAF  AF_Default;
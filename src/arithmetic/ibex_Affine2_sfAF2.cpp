@@ -0,0 +1,820 @@
+/* ============================================================================
+ * I B E X - Implementation of the Affine2Main<AF_sfAF2> class based on a sparse fAF version 2
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+#include "ibex_Affine2_sfAF2.h"
+#include "ibex_Affine2.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace ibex {
+
+int AF_sfAF2::max_terms = 64;
+
+double AF_sfAF2::condense() {
+	int nb_noise = _nnz-1;
+
+	if (max_terms<=0 || nb_noise<=max_terms) return 0.0;
+
+	int nb_removed = nb_noise - max_terms;
+
+	// the magnitude of the largest removed term
+	std::vector<double> mag(nb_noise);
+	for (int k=1; k<_nnz; k++) mag[k-1]=fabs(_val[k]);
+	std::nth_element(mag.begin(), mag.begin()+(nb_removed-1), mag.end());
+	double threshold=mag[nb_removed-1];
+
+	// terms equal to the threshold are removed
+	// only to reach the expected number.
+	int nb_below=0;
+	for (int k=1; k<_nnz; k++)
+		if (fabs(_val[k])<threshold) nb_below++;
+	int nb_equal=nb_removed-nb_below;
+
+	Interval sum(0.0);
+	int j=1;
+	for (int k=1; k<_nnz; k++) {
+		double v=fabs(_val[k]);
+		if (v<threshold || (v==threshold && nb_equal-- > 0)) {
+			sum += v;
+		} else {
+			_ind[j]=_ind[k];
+			_val[j]=_val[k];
+			j++;
+		}
+	}
+	_nnz=j;
+
+	return sum.ub();
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::operator=(const Interval& x) {
+
+	if (x.is_empty()) {
+		_n = -1;
+		_elt._err = 0.0;
+		_elt.clear();
+	} else if (x.ub()>= POS_INFINITY && x.lb()<= NEG_INFINITY ) {
+		_n = -2;
+		_elt._err = 0.0;
+		_elt.clear();
+	} else if (x.ub()>= POS_INFINITY ) {
+		_n = -3;
+		_elt._err = x.lb();
+		_elt.clear();
+	} else if (x.lb()<= NEG_INFINITY ) {
+		_n = -4;
+		_elt._err = x.ub();
+		_elt.clear();
+	} else  {
+		_n = 0;
+		_elt.resize(1);
+		_elt._ind[0] = 0;
+		_elt._val[0] = x.mid();
+		_elt._err	= x.rad();
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_sfAF2>::Affine2Main() :
+		 _n		(-2		),
+		 _elt	(POS_INFINITY)	{
+ }
+
+template<>
+Affine2Main<AF_sfAF2>::Affine2Main(int n, int m, const Interval& itv) :
+			_n 		(n),
+			_elt	(0.0)
+{
+	assert((n>=0) && (m>=0) && (m<=n));
+	if (!(itv.is_unbounded()||itv.is_empty())) {
+		if (m == 0) {
+			_elt.resize(1);
+			_elt._err = itv.rad();
+		} else {
+			_elt.resize(2);
+			_elt._ind[1] = m;
+			_elt._val[1] = itv.rad();
+		}
+		_elt._ind[0] = 0;
+		_elt._val[0] = itv.mid();
+	} else {
+		*this = itv;
+	}
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>::Affine2Main(const double d) :
+			_n 		(0),
+			_elt	(0.0) {
+	if (fabs(d)<POS_INFINITY) {
+		_elt.resize(1);
+		_elt._err = 0.0; //abs(d)*AF_EE();
+		_elt._ind[0] = 0;
+		_elt._val[0] = d;
+	} else {
+		_n=-1;
+		_elt._err = d;
+	}
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>::Affine2Main(const Interval & itv):
+			_n 		(0),
+			_elt	(0.0) {
+
+	if (itv.is_empty()) {
+		_n = -1;
+	} else if (itv.ub()>= POS_INFINITY && itv.lb()<= NEG_INFINITY ) {
+		_n = -2;
+	} else if (itv.ub()>= POS_INFINITY ) {
+		_n = -3;
+		_elt._err = itv.lb();
+	} else if (itv.lb()<= NEG_INFINITY ) {
+		_n = -4;
+		_elt._err = itv.ub();
+	} else  {
+		_n = 0;
+		_elt.resize(1);
+		_elt._ind[0] = 0;
+		_elt._val[0] = itv.mid();
+		_elt._err	= itv.rad();
+	}
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>::Affine2Main(const Affine2Main<AF_sfAF2>& x) :
+		_n		(x._n),
+		_elt	(x._elt._err ) {
+	if (is_actif()) {
+		_elt.resize(x._elt._nnz);
+		for (int k = 0; k < x._elt._nnz; k++){
+			_elt._ind[k] = x._elt._ind[k];
+			_elt._val[k] = x._elt._val[k];
+		}
+	}
+}
+
+
+
+template<>
+double Affine2Main<AF_sfAF2>::val(int i) const{
+	assert((0<=i) && (i<=_n));
+	int k = _elt.find(i);
+	return (k==-1)? 0.0 : _elt._val[k];
+}
+
+template<>
+double Affine2Main<AF_sfAF2>::err() const{
+	return _elt._err;
+}
+
+
+
+template<>
+const Interval Affine2Main<AF_sfAF2>::itv() const {
+
+	if (is_actif()) {
+		Interval res(_elt._val[0]);
+		Interval pmOne(-1.0, 1.0);
+		for (int k = 1; k < _elt._nnz; k++){
+			res += (_elt._val[k] * pmOne);
+		}
+		res += _elt._err * pmOne;
+		return res;
+	} else if (_n==-1) {
+		return Interval::EMPTY_SET;
+	} else if (_n==-2) {
+		return Interval::ALL_REALS;
+	} else if (_n==-3) {
+		return Interval(_elt._err,POS_INFINITY);
+	} else  {  //if (_n==-4)
+		return Interval(NEG_INFINITY,_elt._err);
+	}
+
+}
+
+
+template<>
+double Affine2Main<AF_sfAF2>::mid() const{
+	return (is_actif())? _elt._val[0] : itv().mid();
+}
+
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::operator=(const Affine2Main<AF_sfAF2>& x) {
+	if (this != &x) {
+		_elt._err = x._elt._err;
+		_n = x._n;
+		if (x.is_actif()) {
+			if (_elt._nnz!=x._elt._nnz) {
+				_elt.resize(x._elt._nnz);
+			}
+
+			for (int k = 0; k < x._elt._nnz; k++) {
+				_elt._ind[k] = x._elt._ind[k];
+				_elt._val[k] = x._elt._val[k];
+			}
+		} else {
+			_elt.clear();
+		}
+	}
+	return *this;
+
+}
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::operator=(double d) {
+
+	if (fabs(d)<POS_INFINITY) {
+		_n = 0;
+		_elt.resize(1);
+		_elt._err = 0.0; //abs(d)*AF_EE();
+		_elt._ind[0] = 0;
+		_elt._val[0] = d;
+	} else {
+		if (d>0) {
+			_n = -3;
+		} else {
+			_n = -4;
+		}
+		_elt._err = d;
+		_elt.clear();
+	}
+	return *this;
+}
+
+
+
+/** \brief Return (-x) */
+template<>
+Affine2Main<AF_sfAF2> Affine2Main<AF_sfAF2>::operator-() const {
+	Affine2Main<AF_sfAF2> res;
+	res._n = _n;
+	res._elt._err = _elt._err;
+	if (is_actif()) {
+		res._elt.resize(_elt._nnz);
+		for (int k = 0; k < _elt._nnz; k++) {
+			res._elt._ind[k] = _elt._ind[k];
+			res._elt._val[k] = (-_elt._val[k]);
+		}
+
+	}
+	return res;
+}
+
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::saxpy(double alpha, const Affine2Main<AF_sfAF2>& y, double beta, double ddelta, bool B1, bool B2, bool B3, bool B4) {
+	double temp, ttt, sss, eee;
+	int k;
+	if (is_actif()) {
+		if (B1) {  // multiply by a scalar alpha
+			if (alpha==0.0) {
+				_elt._nnz = 1;
+				_elt._val[0] = 0;
+				_elt._err = 0;
+			}
+			else if ((fabs(alpha)) < POS_INFINITY) {
+				ttt= 0.0;
+				sss= 0.0;
+				int j=0;
+				for (k=0; k<_elt._nnz; k++) {
+					eee = _elt.twoProd(_elt._val[k], alpha, &temp);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+					if (fabs(temp)<AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(temp));
+						temp = 0.0;
+					}
+					// the center is always stored
+					if (k==0 || temp!=0.0) {
+						_elt._ind[j] = _elt._ind[k];
+						_elt._val[j] = temp;
+						j++;
+					}
+				}
+				_elt._nnz = j;
+
+				_elt._err = (1+2*AF_EM())*(
+						((1+2*AF_EM())*fabs(alpha)*_elt._err) +
+						((AF_EE()*ttt) +
+						(AF_EE()*sss))
+						);
+
+			}
+			else {
+				*this = itv()*alpha;
+			}
+		}
+
+		if (B2) {  // add a affine2 form y
+
+			if (y.is_actif()) {
+				if (_n==y.size()) {
+
+					ttt=0.0;
+					sss=0.0;
+
+					int* ind = new int[_elt._nnz + y._elt._nnz];
+					double* val = new double[_elt._nnz + y._elt._nnz];
+
+					// merge the two sorted lists of terms
+					int kx=0, ky=0, j=0;
+					while (kx<_elt._nnz || ky<y._elt._nnz) {
+						int i;
+						double a=0.0, b=0.0;
+						if (ky==y._elt._nnz || (kx<_elt._nnz && _elt._ind[kx]<y._elt._ind[ky])) {
+							i = _elt._ind[kx]; a = _elt._val[kx++];
+						} else if (kx==_elt._nnz || y._elt._ind[ky]<_elt._ind[kx]) {
+							i = y._elt._ind[ky]; b = y._elt._val[ky++];
+						} else {
+							i = _elt._ind[kx]; a = _elt._val[kx++]; b = y._elt._val[ky++];
+						}
+
+						eee = _elt.twoSum(a, b, &temp);
+						ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+						if (fabs(temp)<AF_EC()) {
+							sss = (1+2*AF_EM())*(sss+ fabs(temp));
+							temp = 0.0;
+						}
+						if (i==0 || temp!=0.0) {
+							ind[j] = i;
+							val[j] = temp;
+							j++;
+						}
+					}
+
+					delete[] _elt._ind;
+					delete[] _elt._val;
+					_elt._ind = ind;
+					_elt._val = val;
+					_elt._nnz = j;
+
+					_elt._err = (1+2*AF_EM())*(
+							(_elt._err+y._elt._err) +
+							((AF_EE()*(ttt)) +
+							(AF_EE()*sss))
+							);
+
+					sss = _elt.condense();
+					if (sss>0) {
+						_elt._err = (1+2*AF_EM())*(_elt._err+sss);
+					}
+
+				} else  {
+					if (_n>y.size()) {
+						*this += y.itv();
+					} else {
+						Interval tmp1 = itv();
+						*this = y;
+						*this += tmp1;
+					}
+				}
+			}
+			else { // y is not a valid affine2 form. So we add y.itv() such as an interval
+				*this = itv()+y.itv();
+			}
+		}
+		if (B3) {  //add a constant beta
+			if ((fabs(beta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._val[0],beta,&temp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				if (fabs(temp)<AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+fabs(temp));
+					_elt._val[0] = 0.0;
+				}
+				else {
+					_elt._val[0]=temp;
+				}
+				_elt._err = (1+2*AF_EM())*(
+						_elt._err +
+						(AF_EE()*(ttt)+
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+beta;
+			}
+		}
+
+		if (B4) {  // add an error  ddelta
+
+			if ((fabs(ddelta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._err,fabs(ddelta), &temp);
+				ttt = (1+2*AF_EM())*(fabs(eee));
+				if (fabs(temp)<AF_EC()) {
+					sss = (1+2*AF_EM())*(fabs(temp));
+					temp =0;
+				}
+				_elt._err = (1+2*AF_EM())*(
+						temp +
+						(AF_EE()*(ttt) +
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+Interval(-1,1)*ddelta;
+			}
+		}
+
+		if (_elt._val != NULL) {
+			bool b = (_elt._err<POS_INFINITY);
+			for (k=0;k<_elt._nnz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	} else {
+		if (B1) {  //scalar alpha
+			*this = itv()* alpha;
+		}
+		if (B2) {  // add y
+			*this = itv()+ y.itv();
+		}
+		if (B3) {  //constant beta
+			*this = itv()+ beta;
+		}
+		if (B4) {  // error  delta
+			*this = itv()+Interval(-1,1)*ddelta;
+		}
+	}
+	return *this;
+
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::operator*=(const Interval& y) {
+	if (	(!is_actif())||
+			y.is_empty()||
+			y.is_unbounded() ) {
+		*this = itv()*y;
+
+	} else {
+		double  ttt, sss,  yVal0, eee, temp;
+		int k;
+
+		ttt=0.0; sss=0.0;  yVal0=0.0; eee=0.0;
+		yVal0 = y.mid();
+		// RES = X%(0) * res
+		int j=0;
+		for (k=0; k<_elt._nnz;k++) {
+			eee = _elt.twoProd(_elt._val[k], yVal0, &temp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			if (fabs(temp)<AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(temp));
+				temp = 0.0;
+			}
+			if (k==0 || temp!=0.0) {
+				_elt._ind[j] = _elt._ind[k];
+				_elt._val[j] = temp;
+				j++;
+			}
+		}
+		_elt._nnz = j;
+
+		_elt._err = (1+2*AF_EM())*(
+				(1+2*AF_EM())*(abs(y).ub())*_elt._err +
+				((AF_EE()*ttt) +
+				(AF_EE()*sss))
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY);
+			for (k=0;k<_elt._nnz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::operator*=(const Affine2Main<AF_sfAF2>& y) {
+
+	if (is_actif() && (y.is_actif())) {
+
+		if (_n==y.size()) {
+			double Sx, Sy, Sxy, Sz, ttt, sss, ppp, tmp, xVal0, eee;
+			int k, kx, ky, j;
+
+			Sx=0.0; Sy=0.0; Sxy=0.0; Sz=0.0; ttt=0.0; sss=0.0; ppp=0.0; tmp=0.0; xVal0=0.0; eee=0.0;
+
+			// the products of the noise terms (common indices only)
+			kx=1; ky=1;
+			while (kx<_elt._nnz && ky<y._elt._nnz) {
+				if (_elt._ind[kx]<y._elt._ind[ky]) kx++;
+				else if (y._elt._ind[ky]<_elt._ind[kx]) ky++;
+				else {
+					eee = _elt.twoProd(_elt._val[kx],y._elt._val[ky], &ppp);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+					eee = _elt.twoSum(Sz,ppp, &tmp);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+					Sz = tmp;
+
+					if (fabs(Sz) < AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(Sz));
+						Sz = 0.0;
+					}
+
+					eee = _elt.twoSum(Sxy,fabs(ppp), &tmp);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+					Sxy = tmp;
+
+					if (fabs(Sxy) < AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(Sxy));
+						Sxy = 0.0;
+					}
+					kx++; ky++;
+				}
+			}
+
+			for (kx = 1; kx < _elt._nnz; kx++) {
+				eee = _elt.twoSum(Sx,fabs(_elt._val[kx]), &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sx = tmp;
+
+				if (fabs(Sx) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sx));
+					Sx = 0.0;
+				}
+			}
+
+			for (ky = 1; ky < y._elt._nnz; ky++) {
+				eee = _elt.twoSum(Sy,fabs(y._elt._val[ky]), &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sy = tmp;
+
+				if (fabs(Sy) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sy));
+					Sy = 0.0;
+				}
+			}
+
+			xVal0 = _elt._val[0];
+
+			int* ind = new int[_elt._nnz + y._elt._nnz];
+			double* val = new double[_elt._nnz + y._elt._nnz];
+
+			//RES = ( Y%(0) * X ) + ( X%T(0) * Y - X%T(0)*Y%(0) )
+			kx=0; ky=1; j=0;
+			while (kx<_elt._nnz || ky<y._elt._nnz) {
+				int i;
+				double a=0.0, b=0.0;
+
+				bool in_x = (ky==y._elt._nnz || (kx<_elt._nnz && _elt._ind[kx]<=y._elt._ind[ky]));
+				bool in_y = (kx==_elt._nnz || (ky<y._elt._nnz && y._elt._ind[ky]<=_elt._ind[kx]));
+
+				i = in_x ? _elt._ind[kx] : y._elt._ind[ky];
+
+				if (in_x) {
+					// X%T(0) * res
+					eee = _elt.twoProd(_elt._val[kx],y._elt._val[0], &a);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+					if (fabs(a) < AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(a));
+						a = 0.0;
+					}
+					kx++;
+				}
+
+				if (in_y) {
+					// Xtmp = X%T(0) * Y
+					eee = _elt.twoProd(xVal0,y._elt._val[ky], &b);
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+					if (fabs(b) < AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(b));
+						b = 0.0;
+					}
+					ky++;
+				}
+
+				eee = _elt.twoSum(a,b, &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+				if (fabs(tmp) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(tmp));
+					tmp = 0.0;
+				}
+
+				if (i==0 || tmp!=0.0) {
+					ind[j] = i;
+					val[j] = tmp;
+					j++;
+				}
+			}
+
+			delete[] _elt._ind;
+			delete[] _elt._val;
+			_elt._ind = ind;
+			_elt._val = val;
+			_elt._nnz = j;
+
+			eee = _elt.twoProd(0.5,Sz, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(_elt._val[0],ppp, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			_elt._val[0] = tmp;
+
+			if (fabs(_elt._val[0]) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[0]));
+				_elt._val[0] = 0.0;
+			}
+
+			eee = _elt.twoSum(_elt._err,Sx, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(y._elt._err,Sy, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+
+			_elt._err = (1+ 2*AF_EM()) * (
+					((1+ 2*AF_EM()) *fabs(y._elt._val[0]) * _elt._err)  +
+					((1+ 2*AF_EM()) *fabs(xVal0) * y._elt._err)  +
+					((1+ 2*AF_EM()) *(tmp * ppp)) +
+					((1- 2*AF_EM()) *(-0.5) *  Sxy)  +
+					(AF_EE() * (ttt))  +
+					(AF_EE() * sss)
+					);
+
+			sss = _elt.condense();
+			if (sss>0) {
+				_elt._err = (1+2*AF_EM())*(_elt._err+sss);
+			}
+
+			{
+				bool b = (_elt._err<POS_INFINITY);
+				for (k=0;k<_elt._nnz;k++) {
+					b &= (fabs(_elt._val[k])<POS_INFINITY);
+				}
+				if (!b) {
+					*this = Interval::ALL_REALS;
+				}
+			}
+
+		} else {
+			if (_n>y.size()) {
+				*this *= y.itv();
+			} else {
+				Interval tmp1 = this->itv();
+				*this = y;
+				*this *= tmp1;
+			}
+		}
+
+
+	} else {
+		*this = itv()*y.itv();
+	}
+
+	return *this;
+}
+
+
+template<>
+Affine2Main<AF_sfAF2>& Affine2Main<AF_sfAF2>::sqr(const Interval itv) {
+
+	if (	(!is_actif())||
+			itv.is_empty()||
+			itv.is_unbounded()||
+			(itv.diam() < AF_EC())  ) {
+		*this = pow(itv,2);
+
+	} else  {
+
+		double Sx, Sx2, ttt, sss, ppp, x0, eee,tmp;
+		Sx = 0; Sx2 = 0; ttt = 0; sss = 0; ppp = 0; x0 = 0; eee =0.0; tmp =0.0;
+
+		// compute the error
+		for (int k = 1; k < _elt._nnz; k++) {
+
+			eee = _elt.twoProd(_elt._val[k],_elt._val[k], &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(Sx2,ppp, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			Sx2 = tmp;
+
+			if (fabs(Sx2) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(Sx2));
+				Sx2 = 0.0;
+			}
+
+			eee = _elt.twoSum(Sx,fabs(_elt._val[k]), &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			Sx = tmp;
+
+			if (fabs(Sx) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(Sx));
+				Sx = 0.0;
+			}
+
+		}
+		// compute 2*_elt._val[0]*(*this)
+		x0 = _elt._val[0];
+
+		eee = _elt.twoProd(x0,x0, &ppp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+		_elt._val[0] = ppp;
+
+		if (fabs(_elt._val[0]) < AF_EC()) {
+			sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[0]));
+			_elt._val[0] = 0.0;
+		}
+
+		// compute 2*_elt._val[0]*(*this)
+		int j=1;
+		for (int k = 1; k < _elt._nnz; k++) {
+
+			eee = _elt.twoProd((2*x0),_elt._val[k], &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			if (fabs(ppp) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(ppp));
+			} else {
+				_elt._ind[j] = _elt._ind[k];
+				_elt._val[j] = ppp;
+				j++;
+			}
+
+		}
+		_elt._nnz = j;
+
+		eee = _elt.twoProd(0.5,Sx2, &ppp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		eee = _elt.twoSum(_elt._val[0],ppp, &tmp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+		_elt._val[0] = tmp;
+
+		if (fabs(_elt._val[0]) < AF_EC()) {
+			sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[0]));
+			_elt._val[0] = 0.0;
+		}
+
+		eee = _elt.twoSum(_elt._err,Sx, &tmp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		_elt._err = (1+ 2*AF_EM()) * (
+				((1+ 2*AF_EM()) *2*fabs(x0) * _elt._err)  +
+				((1+ 2*AF_EM()) *(tmp * tmp)) +
+				((1- 2*AF_EM()) *(-0.5) *  Sx2)  +
+				(AF_EE() * (ttt))  +
+				(AF_EE() * sss)
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY);
+			for (int k=0;k<_elt._nnz;k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+
+	return *this;
+}
+
+
+
+
+}// end namespace ibex
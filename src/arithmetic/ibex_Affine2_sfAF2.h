@@ -0,0 +1,197 @@
+/* ============================================================================
+ * I B E X - Definition of the Affine2 class based on a sparse fAF version 2
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef IBEX_AFFINE2_SFAF2_H_
+#define IBEX_AFFINE2_SFAF2_H_
+
+#include "ibex_Interval.h"
+
+
+namespace ibex {
+
+/**
+ * \brief Sparse version of fAF2.
+ *
+ * Same arithmetic as AF_fAF2 but only the nonzero terms of the affine
+ * form are stored, as (index,value) pairs sorted by increasing index.
+ * The cost of an operation is linear in the number of nonzero terms
+ * instead of the total number of noise symbols.
+ *
+ * When the number of nonzero noise terms exceeds #max_terms, the
+ * form is condensed: the smallest terms are removed and their
+ * magnitude is added to the error term.
+ *
+ * This backend is not the default one. It can be selected as
+ * AF_Default in ibex_Affine2.h.
+ */
+class AF_sfAF2 {
+
+	friend class Affine2Main<AF_sfAF2>;
+
+public:
+	/**
+	 * \brief Maximal number of noise terms kept in an affine form.
+	 *
+	 * 0 means no limit. Default value is 64.
+	 */
+	static int max_terms;
+
+private:
+	/**
+	 * Storage of the terms (the case is given by Affine2Main::_n):
+	 * if the affine form is actif (_n>0), the _nnz nonzero terms are
+	 * stored in _ind/_val, with _ind[0]=0 and _val[0] the center; noise
+	 * symbols that are not in _ind have a zero coefficient.
+	 * if the set is degenerate (_n = 0), only the center is stored
+	 * and _err is the radius.
+	 * Otherwise, no term is stored (_nnz=0) and _err is the finite bound
+	 * of the set: a for [a, +oo[ (_n = -3) and ]-oo, a] (_n = -4),
+	 * 0 for the empty set (_n = -1) and ]-oo,+oo[ (_n = -2).
+	 */
+
+	int _nnz;			// number of stored terms (the center included)
+	int * _ind; 		// indices of the stored terms, in increasing order
+	double * _val; 		// values of the stored terms
+	double _err; 		// error of the affine form, corresponded to the last term
+
+	/**
+	 * \brief Allocate the storage for nnz terms (previous terms are lost).
+	 */
+	void resize(int nnz);
+
+	/**
+	 * \brief Free the storage.
+	 */
+	void clear();
+
+	/**
+	 * \brief Position of the ith term in the storage, or -1 if it is zero.
+	 */
+	int find(int i) const;
+
+	/**
+	 * \brief Remove the smallest noise terms so that at most
+	 * #max_terms remain.
+	 *
+	 * \return an upper bound of the sum of the magnitudes of the removed terms.
+	 */
+	double condense();
+
+	/**
+	 * \brief return the exact rounding error of the addition of 2 floating-point numbers
+	 */
+	double twoSum(double a, double b, double *res);
+
+	/**
+	 * \brief return the exact rounding error of the multiplication of 2 floating-point numbers
+	 */
+	double twoProd(double a, double b, double *res);
+	void Split(double x, int sp, double *x_high, double *x_low);
+
+
+
+public:
+	/** \brief Create an empty affine form. */
+	AF_sfAF2(double err);
+
+	/** \brief  Delete the affine form */
+	virtual ~AF_sfAF2();
+
+};
+
+
+inline AF_sfAF2::AF_sfAF2(double err) :
+	_nnz	(0),
+	_ind	(NULL),
+	_val	(NULL),
+	_err	(err) {
+
+}
+
+inline AF_sfAF2::~AF_sfAF2() {
+	clear();
+}
+
+inline void AF_sfAF2::clear() {
+	if (_val!=NULL) {
+		delete[] _ind;
+		delete[] _val;
+		_ind = NULL;
+		_val = NULL;
+	}
+	_nnz = 0;
+}
+
+inline void AF_sfAF2::resize(int nnz) {
+	clear();
+	_ind = new int[nnz];
+	_val = new double[nnz];
+	_nnz = nnz;
+}
+
+inline int AF_sfAF2::find(int i) const {
+	int lo=0;
+	int hi=_nnz-1;
+	while (lo<=hi) {
+		int mid=(lo+hi)/2;
+		if (_ind[mid]==i) return mid;
+		else if (_ind[mid]<i) lo=mid+1;
+		else hi=mid-1;
+	}
+	return -1;
+}
+
+
+/////////////////////
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.132-139
+inline void AF_sfAF2::Split(double x, int sp, double *x_high, double *x_low)
+{
+	unsigned long C = (1UL << sp) + 1;
+	double gamma = (C * x);
+	double delta = (x - gamma);
+	*x_high= (gamma + delta);
+	*x_low= (x - *x_high);
+}
+
+inline double AF_sfAF2::twoProd(double x, double y, double *r_1)
+{
+	int SHIFT_POW = 27; //  53 / 2 for double precision.
+	double x_high, x_low;
+	double y_high, y_low;
+	double t_1;
+	double t_2;
+	double t_3;
+	Split(x, SHIFT_POW, &x_high, &x_low);
+	Split(y, SHIFT_POW, &y_high, &y_low);
+	*r_1 = (x * y);
+	t_1 = (-*r_1 + x_high * y_high);
+	t_2 =   (t_1 + x_high * y_low );
+	t_3 =	(t_2 + x_low  * y_high);
+	return  (t_3 + x_low  * y_low );
+}
+
+
+
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.130
+inline double AF_sfAF2::twoSum(double a, double b, double *res) {
+	*res = (a+b);
+	double a2 = (*res - b);
+	double b2 = (*res - a2);
+	double delta_a = (a - a2);
+	double delta_b = (b - b2);
+	return (delta_a + delta_b);
+}
+
+//////////////////////
+
+}
+
+#endif /* IBEX_AFFINE2_SFAF2_H_ */
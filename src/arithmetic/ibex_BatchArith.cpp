@@ -0,0 +1,82 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchArith.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_IntervalVector.h"
+
+#include <fenv.h>
+#include <vector>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * v[k]:=v[k]^p for all k (p>0), by binary powering. The vector is
+ * processed one bit of p at a time so that each pass is a plain loop
+ * over contiguous doubles (vectorizable). As all the v[k] are
+ * nonnegative, the result is a lower (resp. upper) bound of v[k]^p if
+ * the rounding mode is downward (resp. upward).
+ */
+void pow_pos(vector<double>& v, int p) {
+	int m=v.size();
+	vector<double> r(m,1.0);
+	while (true) {
+		if (p & 1)
+			for (int k=0; k<m; k++) r[k]*=v[k];
+		p>>=1;
+		if (p==0) break;
+		for (int k=0; k<m; k++) v[k]*=v[k];
+	}
+	v.swap(r);
+}
+
+} // end anonymous namespace
+
+IntervalVector pow(const IntervalVector& x, int p) {
+	int n=x.size();
+	IntervalVector y(n);
+
+	// indices of the nonnegative components (processed in a batch)
+	vector<int> idx;
+	idx.reserve(n);
+
+	for (int i=0; i<n; i++) {
+		if (p>0 && !x[i].is_empty() && x[i].lb()>=0)
+			idx.push_back(i);
+		else
+			y[i]=pow(x[i],p);
+	}
+
+	int m=idx.size();
+	if (m==0) return y;
+
+	vector<double> lo(m), up(m);
+	for (int k=0; k<m; k++) {
+		lo[k]=x[idx[k]].lb();
+		up[k]=x[idx[k]].ub();
+	}
+
+	// two switches of the rounding mode only
+	int mode=fegetround();
+	fesetround(FE_DOWNWARD);
+	pow_pos(lo,p);
+	fesetround(FE_UPWARD);
+	pow_pos(up,p);
+	fesetround(mode);
+
+	for (int k=0; k<m; k++)
+		y[idx[k]]=Interval(lo[k],up[k]);
+
+	return y;
+}
+
+} // end namespace ibex
@@ -558,6 +558,68 @@ IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2);
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2);
 
+/**
+ * \brief $[m]_1*[m]_2$ with midpoint-radius arithmetic.
+ *
+ * The product is computed as in [Rump 1999, "Fast and parallel interval
+ * arithmetic", BIT 39(3)], i.e., with three floating-point (cache-blocked)
+ * matrix products instead of O(n^3) interval multiplications:
+ *
+ *    < mid1*mid2 , |mid1|*rad2 + rad1*(|mid2|+rad2) >
+ *
+ * Rounding errors are bounded a posteriori so that the result is a
+ * rigorous enclosure of the exact product, whatever the current
+ * rounding mode is.
+ *
+ * Precision loss w.r.t. the standard product (operator*):
+ * <ul>
+ * <li> if one of the factors is a real matrix (e.g., preconditioning
+ *      C*[A]), the enclosure is the exact interval product up to
+ *      a relative error of order k*eps, where k is the inner dimension.
+ * <li> otherwise, the radius of each entry is overestimated by a factor
+ *      at most 1.5 (plus rounding errors). The worst case occurs with
+ *      intervals like [0,2]*[0,2] (<1,1>*<1,1> gives <1,3> instead of [0,4]).
+ * </ul>
+ *
+ * If one entry is unbounded, the standard product is used.
+ */
+IntervalMatrix mul_mid_rad(const IntervalMatrix& m1, const IntervalMatrix& m2);
+
+/**
+ * \brief $[m]_1*[m]_2$ with midpoint-radius arithmetic (only two floating-point products).
+ *
+ * \see #mul_mid_rad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalMatrix mul_mid_rad(const Matrix& m1, const IntervalMatrix& m2);
+
+/**
+ * \brief $[m]_1*[m]_2$ with midpoint-radius arithmetic.
+ *
+ * \see #mul_mid_rad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalMatrix mul_mid_rad(const IntervalMatrix& m1, const Matrix& m2);
+
+/**
+ * \brief $[m]*[x]$ with midpoint-radius arithmetic.
+ *
+ * \see #mul_mid_rad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalVector mul_mid_rad(const IntervalMatrix& m, const IntervalVector& x);
+
+/**
+ * \brief $[m]*[x]$ with midpoint-radius arithmetic.
+ *
+ * \see #mul_mid_rad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalVector mul_mid_rad(const Matrix& m, const IntervalVector& x);
+
+/**
+ * \brief $[m]*[x]$ with midpoint-radius arithmetic.
+ *
+ * \see #mul_mid_rad(const IntervalMatrix&, const IntervalMatrix&).
+ */
+IntervalVector mul_mid_rad(const IntervalMatrix& m, const Vector& x);
+
 /**
  * \brief Outer product (multiplication of a column vector by a row vector).
  */
@@ -660,6 +660,16 @@ IntervalVector hadamard_product(const IntervalVector& x, const IntervalVector& y
  */
 IntervalVector abs(const IntervalVector& x);
 
+/**
+ * \brief x^p, component-wise.
+ *
+ * The nonnegative components (for p>0) are processed in a batch with
+ * directed rounding (the rounding mode is switched twice for the whole
+ * vector). The other components are enclosed by the scalar pow.
+ * A component of the result is empty iff the same component of x is empty.
+ */
+IntervalVector pow(const IntervalVector& x, int p);
+
 /**
  * \brief Projection of $y=x_1+x_2$.
  *
@@ -12,6 +12,12 @@
 #include "ibex_Affine2Matrix.h"
 #include "ibex_IntervalMatrix.h"
 
+#include <float.h>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
 namespace ibex {
 
 namespace {
@@ -249,6 +255,197 @@ inline Mout mulMM(const Min1& m1, const Min2& m2) {
 	return m3;
 }
 
+/*================================ midpoint-radius products ================================*/
+
+// split a scalar into midpoint and (upward rounded) radius.
+inline bool mid_rad(double x, double& mid, double& rad) {
+	mid=x; rad=0;
+	return fabs(x)<POS_INFINITY;
+}
+
+inline bool mid_rad(const Interval& x, double& mid, double& rad) {
+	if (x.is_unbounded()) return false;
+	mid=x.mid();
+	rad=(x-mid).mag();
+	return true;
+}
+
+inline bool has_rad(double)            { return false; }
+inline bool has_rad(const Interval&)   { return true; }
+
+// size of the blocks in the floating-point matrix product
+const int MUL_BLOCK_SIZE=64;
+
+/*
+ * C:=A*B where A (m x k), B (k x n) and C (m x n) are row-major
+ * floating-point matrices. No rounding control is performed.
+ * The loops are blocked so that a block of B remains in cache.
+ */
+void float_mul(const double* A, const double* B, double* C, int m, int k, int n) {
+
+	for (int i=0; i<m*n; i++) C[i]=0;
+
+	for (int kk=0; kk<k; kk+=MUL_BLOCK_SIZE) {
+		int kend=kk+MUL_BLOCK_SIZE<k? kk+MUL_BLOCK_SIZE : k;
+
+		for (int jj=0; jj<n; jj+=MUL_BLOCK_SIZE) {
+			int jend=jj+MUL_BLOCK_SIZE<n? jj+MUL_BLOCK_SIZE : n;
+
+			for (int i=0; i<m; i++) {
+				double* c=&C[i*n];
+				for (int p=kk; p<kend; p++) {
+					double a=A[i*k+p];
+					if (a==0) continue;
+					const double* b=&B[p*n];
+					for (int j=jj; j<jend; j++)
+						c[j]+=a*b[j];
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Midpoint-radius product [A]*[B] where [A] is (m x k) and [B] is (k x n).
+ *
+ * [A] = <mA,rA> and [B] = <mB,rB> (rA or rB is NULL for real matrices).
+ * Following [Rump 1999, "Fast and parallel interval arithmetic"]:
+ *
+ *     [A]*[B] is enclosed by < mA*mB , |mA|*rB + rA*(|mB|+rB) >.
+ *
+ * The three products mA*mB, |mA|*W and rA*Q are computed with floating-point
+ * numbers, whatever the current rounding mode is, and the rounding errors
+ * are bounded a posteriori with the classical bound (the unit roundoff
+ * being DBL_EPSILON in any rounding mode, eta the smallest subnormal):
+ *
+ *     |fl(X*Y)-X*Y| <= gamma_k |X|*|Y| + k*eta,  gamma_k=k*eps/(1-k*eps).
+ *
+ * The error of the midpoint product is merged into the first radius product
+ * by taking W=gamma_k|mB|+rB (rounded upward). Q=|mB|+rB (rounded upward).
+ *
+ * Entries that overflow are computed with the standard interval product.
+ *
+ * Return false if some entry of [A] or [B] is unbounded (nothing is done).
+ */
+template<class Min1, class Min2>
+bool mul_mid_rad(const Min1& m1, const Min2& m2, int m, int k, int n, Interval* res) {
+	assert(k*DBL_EPSILON<0.5);
+
+	const bool radA=has_rad(m1[0][0]);
+	const double eta=std::numeric_limits<double>::denorm_min();
+
+	vector<double> mA(m*k), rA(radA? m*k : 0), absmA(m*k);
+	vector<double> mB(k*n), W(k*n), Q(radA? k*n : 0);
+
+	for (int i=0; i<m; i++)
+		for (int p=0; p<k; p++) {
+			double r;
+			if (!mid_rad(m1[i][p],mA[i*k+p],r)) return false;
+			if (radA) rA[i*k+p]=r;
+			absmA[i*k+p]=fabs(mA[i*k+p]);
+		}
+
+	const Interval gamma=Interval(k)*DBL_EPSILON/(1.0-Interval(k)*DBL_EPSILON);
+
+	for (int p=0; p<k; p++)
+		for (int j=0; j<n; j++) {
+			double mid,r;
+			if (!mid_rad(m2[p][j],mid,r)) return false;
+			mB[p*n+j]=mid;
+			W[p*n+j]=(gamma*fabs(mid)+r).ub();
+			if (radA) Q[p*n+j]=(Interval(fabs(mid))+r).ub();
+		}
+
+	vector<double> C(m*n), P1(m*n), P2(radA? m*n : 0);
+
+	float_mul(&mA[0], &mB[0], &C[0], m, k, n);
+	float_mul(&absmA[0], &W[0], &P1[0], m, k, n);
+	if (radA) float_mul(&rA[0], &Q[0], &P2[0], m, k, n);
+
+	// upper bound of an exact nonnegative product from its computed value
+	const Interval keta=Interval(k)*eta;
+	const Interval corr=1.0/(1.0-gamma);
+
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			int l=i*n+j;
+			Interval rad=(P1[l]+keta)*corr + keta;
+			if (radA) rad+=(P2[l]+keta)*corr;
+
+			if (fabs(C[l])<POS_INFINITY && rad.ub()<POS_INFINITY)
+				res[l]=C[l]+Interval(-rad.ub(),rad.ub());
+			else {
+				res[l]=0;
+				for (int p=0; p<k; p++)
+					res[l]+=m1[i][p]*m2[p][j];
+			}
+		}
+
+	return true;
+}
+
+template<class Min1, class Min2>
+inline IntervalMatrix mulMM_mid_rad(const Min1& m1, const Min2& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	int m=m1.nb_rows();
+	int k=m1.nb_cols();
+	int n=m2.nb_cols();
+
+	IntervalMatrix m3(m,n);
+
+	if (is_empty(m1) || is_empty(m2)) { m3.set_empty(); return m3; }
+
+	vector<Interval> res(m*n);
+
+	if (!mul_mid_rad(m1,m2,m,k,n,&res[0]))
+		return mulMM<Min1,Min2,IntervalMatrix>(m1,m2);
+
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++)
+			m3[i][j]=res[i*n+j];
+
+	return m3;
+}
+
+// a vector seen as a (n x 1) matrix
+template<class V, typename S>
+class ColumnView {
+public:
+	class Row {
+	public:
+		Row(const V& v, int i) : v(v), i(i) { }
+		const S& operator[](int) const { return v[i]; }
+		const V& v;
+		const int i;
+	};
+
+	ColumnView(const V& v) : v(v) { }
+	Row operator[](int i) const { return Row(v,i); }
+	const V& v;
+};
+
+template<class M, class Vin, typename S>
+inline IntervalVector mulMV_mid_rad(const M& m, const Vin& v) {
+	assert(m.nb_cols()==v.size());
+
+	int nb_rows=m.nb_rows();
+
+	IntervalVector y(nb_rows);
+
+	if (is_empty(m) || is_empty(v)) { y.set_empty(); return y; }
+
+	vector<Interval> res(nb_rows);
+
+	if (!mul_mid_rad(m,ColumnView<Vin,S>(v),nb_rows,m.nb_cols(),1,&res[0]))
+		return mulMV<M,Vin,IntervalVector>(m,v);
+
+	for (int i=0; i<nb_rows; i++)
+		y[i]=res[i];
+
+	return y;
+}
+
 template<typename V>
 inline V absV(const V& v) {
 	V res(v.size());
@@ -563,6 +760,30 @@ IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
 	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
 }
 
+IntervalVector mul_mid_rad(const Matrix& m, const IntervalVector& v) {
+	return mulMV_mid_rad<Matrix,IntervalVector,Interval>(m,v);
+}
+
+IntervalVector mul_mid_rad(const IntervalMatrix& m, const Vector& v) {
+	return mulMV_mid_rad<IntervalMatrix,Vector,double>(m,v);
+}
+
+IntervalVector mul_mid_rad(const IntervalMatrix& m, const IntervalVector& v) {
+	return mulMV_mid_rad<IntervalMatrix,IntervalVector,Interval>(m,v);
+}
+
+IntervalMatrix mul_mid_rad(const Matrix& m1, const IntervalMatrix& m2) {
+	return mulMM_mid_rad(m1,m2);
+}
+
+IntervalMatrix mul_mid_rad(const IntervalMatrix& m1, const Matrix& m2) {
+	return mulMM_mid_rad(m1,m2);
+}
+
+IntervalMatrix mul_mid_rad(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	return mulMM_mid_rad(m1,m2);
+}
+
 Vector abs(const Vector& v) {
 	return absV(v);
 }
@@ -0,0 +1,237 @@
+/* ============================================================================
+ * I B E X - ibex_SparseIntervalMatrix.cpp
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SparseIntervalMatrix.h"
+
+namespace ibex {
+
+namespace {
+
+inline bool is_zero(const Interval& x) {
+	return x.lb()==0 && x.ub()==0;
+}
+
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows1, int nb_cols1, const int* row_start, const int* col_index, const Interval* val) :
+		_nb_rows(nb_rows1), _nb_cols(nb_cols1) {
+	assert(nb_rows1>0);
+	assert(nb_cols1>0);
+
+	int nnz=row_start[_nb_rows];
+	_row_start = new int[_nb_rows+1];
+	_col_index = new int[nnz];
+	_val       = new Interval[nnz];
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=row_start[i];
+
+	for (int k=0; k<nnz; k++) {
+		assert(col_index[k]>=0 && col_index[k]<_nb_cols);
+		_col_index[k]=col_index[k];
+		_val[k]=val[k];
+	}
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& m) : _nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()) {
+
+	int nnz=0;
+	for (int i=0; i<_nb_rows; i++)
+		for (int j=0; j<_nb_cols; j++)
+			if (!is_zero(m[i][j])) nnz++;
+
+	_row_start = new int[_nb_rows+1];
+	_col_index = new int[nnz];
+	_val       = new Interval[nnz];
+
+	int k=0;
+	for (int i=0; i<_nb_rows; i++) {
+		_row_start[i]=k;
+		for (int j=0; j<_nb_cols; j++)
+			if (!is_zero(m[i][j])) {
+				_col_index[k]=j;
+				_val[k]=m[i][j];
+				k++;
+			}
+	}
+	_row_start[_nb_rows]=k;
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const SparseIntervalMatrix& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols) {
+	int nnz=m.nb_nonzeros();
+	_row_start = new int[_nb_rows+1];
+	_col_index = new int[nnz];
+	_val       = new Interval[nnz];
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=m._row_start[i];
+
+	for (int k=0; k<nnz; k++) {
+		_col_index[k]=m._col_index[k];
+		_val[k]=m._val[k];
+	}
+}
+
+SparseIntervalMatrix::~SparseIntervalMatrix() {
+	delete[] _row_start;
+	delete[] _col_index;
+	delete[] _val;
+}
+
+SparseIntervalMatrix& SparseIntervalMatrix::operator=(const SparseIntervalMatrix& m) {
+	if (this==&m) return *this;
+
+	int nnz=m.nb_nonzeros();
+
+	if (_nb_rows!=m._nb_rows) {
+		delete[] _row_start;
+		_row_start = new int[m._nb_rows+1];
+	}
+
+	if (nb_nonzeros()!=nnz) {
+		delete[] _col_index;
+		delete[] _val;
+		_col_index = new int[nnz];
+		_val       = new Interval[nnz];
+	}
+
+	_nb_rows=m._nb_rows;
+	_nb_cols=m._nb_cols;
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=m._row_start[i];
+
+	for (int k=0; k<nnz; k++) {
+		_col_index[k]=m._col_index[k];
+		_val[k]=m._val[k];
+	}
+	return *this;
+}
+
+int SparseIntervalMatrix::find(int i, int j) const {
+	assert(i>=0 && i<_nb_rows);
+	assert(j>=0 && j<_nb_cols);
+
+	// dichotomic search in the ith row
+	int lo=_row_start[i];
+	int hi=_row_start[i+1]-1;
+	while (lo<=hi) {
+		int mid=(lo+hi)/2;
+		if (_col_index[mid]==j) return mid;
+		else if (_col_index[mid]<j) lo=mid+1;
+		else hi=mid-1;
+	}
+	return -1;
+}
+
+bool SparseIntervalMatrix::is_empty() const {
+	for (int k=0; k<nb_nonzeros(); k++)
+		if (_val[k].is_empty()) return true;
+	return false;
+}
+
+SparseIntervalMatrix SparseIntervalMatrix::transpose() const {
+	int nnz=nb_nonzeros();
+
+	int* row_start = new int[_nb_cols+1];
+	int* col_index = new int[nnz];
+	Interval* val  = new Interval[nnz];
+
+	// count the entries of each column
+	for (int j=0; j<=_nb_cols; j++) row_start[j]=0;
+	for (int k=0; k<nnz; k++) row_start[_col_index[k]+1]++;
+	for (int j=0; j<_nb_cols; j++) row_start[j+1]+=row_start[j];
+
+	// rows are visited in increasing order so that
+	// the indices of each column remain sorted.
+	int* next = new int[_nb_cols];
+	for (int j=0; j<_nb_cols; j++) next[j]=row_start[j];
+
+	for (int i=0; i<_nb_rows; i++) {
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++) {
+			int p=next[_col_index[k]]++;
+			col_index[p]=i;
+			val[p]=_val[k];
+		}
+	}
+
+	SparseIntervalMatrix t(_nb_cols, _nb_rows, row_start, col_index, val);
+
+	delete[] next;
+	delete[] val;
+	delete[] col_index;
+	delete[] row_start;
+
+	return t;
+}
+
+IntervalMatrix SparseIntervalMatrix::submatrix(int row_start_index, int row_end_index, int col_start_index, int col_end_index) const {
+	assert(row_start_index>=0 && row_start_index<=row_end_index && row_end_index<_nb_rows);
+	assert(col_start_index>=0 && col_start_index<=col_end_index && col_end_index<_nb_cols);
+
+	IntervalMatrix sub(row_end_index-row_start_index+1, col_end_index-col_start_index+1, Interval::ZERO);
+
+	for (int i=row_start_index; i<=row_end_index; i++) {
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++) {
+			int j=_col_index[k];
+			if (j<col_start_index) continue;
+			if (j>col_end_index) break;
+			sub[i-row_start_index][j-col_start_index]=_val[k];
+		}
+	}
+	return sub;
+}
+
+IntervalMatrix SparseIntervalMatrix::to_dense() const {
+	return submatrix(0, _nb_rows-1, 0, _nb_cols-1);
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& m, const Vector& x) {
+	assert(m.nb_cols()==x.size());
+
+	IntervalVector y(m.nb_rows());
+
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=m.row_begin(i); k<m.row_end(i); k++)
+			y[i]+=m.val(k)*x[m.index(k)];
+	}
+	return y;
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& m, const IntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+
+	IntervalVector y(m.nb_rows());
+
+	if (x.is_empty()) { y.set_empty(); return y; }
+
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=m.row_begin(i); k<m.row_end(i); k++)
+			y[i]+=m.val(k)*x[m.index(k)];
+	}
+	return y;
+}
+
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& m) {
+	os << "(";
+	for (int i=0; i<m.nb_rows(); i++) {
+		os << "(";
+		for (int k=m.row_begin(i); k<m.row_end(i); k++) {
+			os << m.index(k) << ":" << m.val(k);
+			if (k<m.row_end(i)-1) os << " ; ";
+		}
+		os << ")";
+		if (i<m.nb_rows()-1) os << " ; ";
+	}
+	os << ")";
+	return os;
+}
+
+} // end namespace ibex
@@ -0,0 +1,226 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix.
+ *
+ * The matrix is stored in compressed sparse row (CSR) format: the
+ * nonzero entries of row i are val(k) for k in [row_begin(i),row_end(i)[,
+ * with column index index(k). Column indices are sorted increasingly
+ * inside each row. Entries that are not stored are the degenerated
+ * interval [0,0].
+ *
+ * The compressed sparse column (CSC) format of a matrix is the CSR
+ * format of its transpose (see #transpose()).
+ */
+class SparseIntervalMatrix {
+
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix from CSR arrays.
+	 *
+	 * \param row_start - array of nb_rows+1 integers, with row_start[nb_rows]=nnz.
+	 * \param col_index - array of nnz column indices (sorted in each row).
+	 * \param val       - array of nnz intervals.
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols, const int* row_start, const int* col_index, const Interval* val);
+
+	/**
+	 * \brief Create a sparse matrix from a dense one.
+	 *
+	 * All the entries equal to [0,0] are dropped.
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Duplicate a matrix.
+	 */
+	SparseIntervalMatrix(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~SparseIntervalMatrix();
+
+	/**
+	 * \brief Set *this to m.
+	 */
+	SparseIntervalMatrix& operator=(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Return the number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Return the number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Return the number of stored (nonzero) entries.
+	 */
+	int nb_nonzeros() const;
+
+	/**
+	 * \brief Ratio of stored entries: nnz/(nb_rows x nb_cols).
+	 */
+	double density() const;
+
+	/**
+	 * \brief Index of the first stored entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Index following the last stored entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column index of the kth stored entry.
+	 */
+	int index(int k) const;
+
+	/**
+	 * \brief Value of the kth stored entry.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth stored entry (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Position k of the entry (i,j) in the storage
+	 * or -1 if this entry is not stored.
+	 *
+	 * Complexity is logarithmic in the number of entries of the ith row.
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief Return the entry (i,j).
+	 *
+	 * Return [0,0] if the entry is not stored.
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief True iff one stored entry is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Transpose of *this (i.e., the CSC format of *this).
+	 */
+	SparseIntervalMatrix transpose() const;
+
+	/**
+	 * \brief Return the dense submatrix [row_start_index..row_end_index]x[col_start_index..col_end_index].
+	 */
+	IntervalMatrix submatrix(int row_start_index, int row_end_index, int col_start_index, int col_end_index) const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix to_dense() const;
+
+private:
+	int _nb_rows;
+	int _nb_cols;
+	int* _row_start;
+	int* _col_index;
+	Interval* _val;
+};
+
+/** \ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief $[m]*[x]$.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& m, const Vector& x);
+
+/**
+ * \brief $[m]*[x]$.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& m, const IntervalVector& x);
+
+/**
+ * \brief Stream out a matrix.
+ */
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix&);
+
+/*@}*/
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_nonzeros() const {
+	return _row_start[_nb_rows];
+}
+
+inline double SparseIntervalMatrix::density() const {
+	return ((double) nb_nonzeros())/(((double) _nb_rows)*_nb_cols);
+}
+
+inline int SparseIntervalMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_start[i];
+}
+
+inline int SparseIntervalMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_start[i+1];
+}
+
+inline int SparseIntervalMatrix::index(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _col_index[k];
+}
+
+inline Interval& SparseIntervalMatrix::val(int k) {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline const Interval& SparseIntervalMatrix::val(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline Interval SparseIntervalMatrix::operator()(int i, int j) const {
+	int k=find(i,j);
+	return k==-1? Interval::ZERO : _val[k];
+}
+
+} // namespace ibex
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
@@ -9,9 +9,6 @@
  * Created     : Oct 7, 2013
  * ---------------------------------------------------------------------------- */
 
-#define __IBEX_TUBE_H__
-#ifndef __IBEX_TUBE_H__ // The class Tube is not ready !!!
-
 #include "ibex_Tube.h"
 #include "assert.h"
 
@@ -19,18 +16,22 @@ namespace ibex {
 
 Tube::Tube(double t0, double tf, double step, const Interval& x) :
 						IntervalVector((int)round(((tf - t0) / step)), x), _t0(t0), _tf(tf), _deltaT(step) {
+	build_tree();
 }
 
 Tube::Tube(double t0, double tf, double step, const IntervalVector& x) :
 						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step) {
+	build_tree();
 }
 
 Tube::Tube(double t0, double tf, double step, double bounds[][2]) :
 						IntervalVector((int)round(((tf - t0) / step)), bounds), _t0(t0), _tf(tf), _deltaT(step) {
+	build_tree();
 }
 
 Tube::Tube(double t0, double tf, double step, const Vector& x) :
 						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step) {
+	build_tree();
 }
 
 Tube::Tube(double t0, double tf, double step, const Function& fmin, const Function& fmax) :
@@ -43,8 +44,46 @@ Tube::Tube(double t0, double tf, double step, const Function& fmin, const Functi
 		lx[0]= Interval(t0+i*step,t0+(i+1)*step);// FIXME A corriger pas robuste, idee stocke les temps dans un tableau pour eviter de les recalculer et d'accumuler des erreurs
 		ux[0]= Interval(t0+i*step,t0+(i+1)*step);
 
-		(*this)[i]=Interval(fmin.eval_vector(lx)[0].lb(),fmax.eval_vector(ux)[0].ub());
+		slice(i)=Interval(fmin.eval_vector(lx)[0].lb(),fmax.eval_vector(ux)[0].ub());
+	}
+	build_tree();
+}
+
+void Tube::build_tree() {
+	int n=size();
+	_hull.resize(2*n);
+	_integ.resize(2*n);
+	for (int i=0; i<n; i++) {
+		_hull[n+i]=(*this)[i];
+		_integ[n+i]=(*this)[i]*_deltaT;
+	}
+	for (int p=n-1; p>=1; p--) {
+		_hull[p]=_hull[2*p] | _hull[2*p+1];
+		_integ[p]=_integ[2*p] + _integ[2*p+1];
+	}
+}
+
+void Tube::set(int i, const Interval& x) {
+	assert(i>=0 && i<size());
+	int p=size()+i;
+	slice(i)=x;
+	_hull[p]=x;
+	_integ[p]=x*_deltaT;
+	for (p/=2; p>=1; p/=2) {
+		_hull[p]=_hull[2*p] | _hull[2*p+1];
+		_integ[p]=_integ[2*p] + _integ[2*p+1];
+	}
+}
+
+Interval Tube::hull(int i1, int i2) const {
+	assert(i1>=0 && i1<=i2 && i2<size());
+	Interval res(Interval::EMPTY_SET);
+	// bottom-up traversal of the nodes covering [i1,i2]
+	for (int l=size()+i1, r=size()+i2+1; l<r; l/=2, r/=2) {
+		if (l&1) res |= _hull[l++];
+		if (r&1) res |= _hull[--r];
 	}
+	return res;
 }
 
 void Tube::set_t0(double t0, Interval inter) {
@@ -54,19 +93,20 @@ void Tube::set_t0(double t0, Interval inter) {
 		int diff = (int)round((_t0-t0)/_deltaT);
 		resize((_tf-t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			if(i<diff) (*this)[i]=inter;
-			else (*this)[i]=temp[i-diff];
+			if(i<diff) slice(i)=inter;
+			else slice(i)=temp[i-diff];
 		}
 	}
 	else {
 		int diff = (int)round((t0-_t0)/_deltaT);
 		resize((_tf-t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			(*this)[i]=temp[i+diff];
+			slice(i)=temp[i+diff];
 		}
 	}
 
 	_t0 = t0;
+	build_tree();
 }
 
 void Tube::set_t0(double t0) {
@@ -79,7 +119,7 @@ void Tube::set_tF(double tf, Interval inter) {
 	if(tf<get_tF()) {
 		resize((tf-_t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			(*this)[i]=temp[i];
+			slice(i)=temp[i];
 		}
 	}
 	else {
@@ -87,12 +127,13 @@ void Tube::set_tF(double tf, Interval inter) {
 		int orsize = temp.size();
 		resize((tf-_t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			if(i<orsize) (*this)[i]=temp[i];
-			else (*this)[i]=inter;
+			if(i<orsize) slice(i)=temp[i];
+			else slice(i)=inter;
 		}
 	}
 
 	_tf = tf;
+	build_tree();
 }
 
 void Tube::set_tF(double tf) {
@@ -101,43 +142,34 @@ void Tube::set_tF(double tf) {
 
 Interval Tube::at(const Interval& time) const {
 	assert(time.lb()>=_t0 && time.ub()<=_tf);
-	Interval temp(Interval::EMPTY_SET);
-	int first_idx=(int)round(time.lb()/_deltaT);
-	int last_idx=(int)round(time.ub()/_deltaT);
-	for(int i=first_idx;i<last_idx;i++) {
-		temp=temp|(*this)[i];
-	}
-	/*
-    for(double t=time.lb();t<time.ub();t+=_deltaT){
-        temp=temp|(*this)[(int)round((t-_t0)/_deltaT)];
-    }
-	 */
-	return temp;
+	// slices overlapping [time]
+	int first_idx=(int)floor((time.lb()-_t0)/_deltaT);
+	int last_idx=(int)ceil((time.ub()-_t0)/_deltaT)-1;
+	if (first_idx<0) first_idx=0;
+	if (last_idx>size()-1) last_idx=size()-1;
+	if (last_idx<first_idx) last_idx=first_idx; // degenerated time
+	return hull(first_idx,last_idx);
 }
 
 
 void Tube::resample(double new_deltaT) {
-	IntervalVector temp = (*this);
 	double ratio = new_deltaT/_deltaT;
-
-	temp.resize((int)round((1/ratio)*(*this).size()));
-
-	if(ratio<1){
-		for(int i=0;i<temp.size();i++) {
-			temp[i]=(*this)[(int)round(i*ratio)];
-		}
-	} else {
-		for(int i=0;i<temp.size();i++) {
-			temp[i]=Interval::EMPTY_SET;
-			for(int j=0;j<ratio;j++) {
-				temp[i]=temp[i]|(*this)[(i*ratio)+j];
-			}
-		}
+	int n=(int)round((1/ratio)*size());
+	IntervalVector temp(n);
+
+	for(int i=0;i<n;i++) {
+		// former slices overlapping the new ith slice
+		int first_idx=(int)floor(i*ratio);
+		int last_idx=(int)ceil((i+1)*ratio)-1;
+		if (last_idx>size()-1) last_idx=size()-1;
+		if (first_idx>last_idx) first_idx=last_idx;
+		temp[i]=hull(first_idx,last_idx);
 	}
 
-	(*this).resize((int)round((1/ratio)*(*this).size()));
-	(*this) = temp;
+	resize(n);
+	((IntervalVector&) *this) = temp;
 	_deltaT = new_deltaT;
+	build_tree();
 }
 
 
@@ -154,57 +186,56 @@ Tube& Tube::operator=(const Tube& x) {
 		_t0 = x._t0;
 		_tf = x._tf;
 		_deltaT = x._deltaT;
+		_hull = x._hull;
+		_integ = x._integ;
 	}
 	return *this;
 }
 
 Tube& Tube::operator=(const IntervalVector& x) {
 	((IntervalVector&) *this)=x;
+	build_tree();
 	return *this;
 }
 
 Tube& Tube::operator &=(const Tube& x) {
 	__assert_tube_time_domain__(*this,x);
 	((IntervalVector&) (*this))&=x;
+	build_tree();
 	return *this;
 }
 
 Tube& Tube::operator |=(const Tube& x) {
 	__assert_tube_time_domain__(*this,x);
 	((IntervalVector&) (*this))|=x;
+	build_tree();
 	return *this;
 }
 
 double Tube::max() const {
 	if(is_unbounded()) return POS_INFINITY;
 	if(is_empty()) return NEG_INFINITY; // BETA
-	double max = (*this)[0].ub();
-	for(int i=1; i<size(); i++) {
-		if((*this)[i].ub()>max) max = (*this)[i].ub();
-	}
-	return max;
+	return _hull[1].ub();
 }
 
 double Tube::min() const {
 	if(is_unbounded()) return -1000; // BETA
 	if(is_empty()) return 0; // BETA
-	double min = (*this)[0].lb();
-	for(int i=1; i<size(); i++){
-		if((*this)[i].lb()<min) min = (*this)[i].lb();
-	}
-	return min;
+	return _hull[1].lb();
 }
 
 Tube& Tube::ctcIn(double time, const Interval& in){
 	assert(time>=_t0 && time<=_tf);
-	(*this)[(int)round((time-_t0)/_deltaT)]&=in;
+	int i=(int)round((time-_t0)/_deltaT);
+	set(i,(*this)[i] & in);
 	return *this;
 }
 
 Tube& Tube::ctcIn(const Interval& time, const Interval& in){
 	assert(time.lb()>=_t0 && time.ub()<=_tf);
 	for(double t=time.lb();t<time.ub();t+=_deltaT){
-		(*this)[(int)round((t-_t0)/_deltaT)]&=in;
+		int i=(int)round((t-_t0)/_deltaT);
+		set(i,(*this)[i] & in);
 	}
 	return *this;
 }
@@ -212,16 +243,18 @@ Tube& Tube::ctcIn(const Interval& time, const Interval& in){
 Tube& Tube::ctcInter(const Tube& x){
 	__assert_tube_time_domain__(*this,x);
 	for(int i=0;i<size();i++){
-		(*this)[i] &= x[i];
+		slice(i) &= x[i];
 	}
+	build_tree();
 	return *this;
 }
 
 Tube& Tube::ctcUnion(const Tube& x){
 	__assert_tube_time_domain__(*this,x);
 	for(int i=0;i<size();i++){
-		(*this)[i] |= x[i];
+		slice(i) |= x[i];
 	}
+	build_tree();
 	return *this;
 }
 
@@ -231,8 +264,9 @@ Tube& Tube::ctcSup(const Tube& x){
 	for(int i=0;i<size();i++){
 		intt=(*this)[i]; intx=x[i];
 		if(intt.lb() < intx.lb())
-			(*this)[i] = Interval(intx.lb(), intt.ub());
+			slice(i) = Interval(intx.lb(), intt.ub());
 	}
+	build_tree();
 	return *this;
 }
 
@@ -242,8 +276,9 @@ Tube& Tube::ctcInf(const Tube& x){
 	for(int i=0;i<size();i++){
 		intt=(*this)[i]; intx=x[i];
 		if(intt.ub() > intx.ub())
-			(*this)[i] = Interval(intt.lb() , intx.ub());
+			slice(i) = Interval(intt.lb() , intx.ub());
 	}
+	build_tree();
 	return *this;
 }
 
@@ -256,8 +291,9 @@ Tube& Tube::ctcFwd(const Function& f) {
 		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i+1] &=(*this)[i]+Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		slice(i+1) &=(*this)[i]+Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
 	}
+	build_tree();
 	return *this;
 }
 
@@ -269,8 +305,9 @@ Tube& Tube::ctcBwd(const Function& f) {
 		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i-1] &= (*this)[i]-Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		slice(i-1) &= (*this)[i]-Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
 	}
+	build_tree();
 	return *this;
 }
 
@@ -284,8 +321,9 @@ Tube& Tube::ctcPeriodic(double period) {
 	assert(period<=_tf);
 	int periodi = (int)round(period/_deltaT);
 	for (int i = 0; i < size(); i++) {
-		(*this)[i] &= (*this)[i%periodi];
+		slice(i) &= (*this)[i%periodi];
 	}
+	build_tree();
 	return *this;
 }
 
@@ -295,16 +333,17 @@ Tube& Tube::ctcCSym(double pivot) {
 	double dist2tf=_tf-pivot;
 	if(dist2t0>dist2tf){// FIXME A corriger pas robuste
 		for(double t=0;t<=dist2tf;t+=_deltaT) {
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			slice((int)round(((pivot+t)-_t0)/_deltaT)) &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
+			slice((int)round(((pivot-t)-_t0)/_deltaT)) &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
 		}
 	}
 	else {
 		for(double t=0;t<=dist2t0;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			slice((int)round(((pivot+t)-_t0)/_deltaT)) &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
+			slice((int)round(((pivot-t)-_t0)/_deltaT)) &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
 		}
 	}
+	build_tree();
 	return *this;
 }
 
@@ -314,16 +353,17 @@ Tube& Tube::ctcASym(double pivot) {
 	double dist2tf=_tf-pivot;
 	if(dist2t0>dist2tf){
 		for(double t=0;t<=dist2tf;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			slice((int)round(((pivot+t)-_t0)/_deltaT)) &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
+			slice((int)round(((pivot-t)-_t0)/_deltaT)) &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
 		}
 	}
 	else {
 		for(double t=0;t<=dist2t0;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			slice((int)round(((pivot+t)-_t0)/_deltaT)) &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
+			slice((int)round(((pivot-t)-_t0)/_deltaT)) &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
 		}
 	}
+	build_tree();
 	return *this;
 }
 
@@ -348,20 +388,24 @@ ScalarTube ScalarTube::timeIntegration(void)
   return u;
 }*/
 
-Interval Tube::integral(const int kmin, const int kmax) {
-	Interval temp(0,0);
-	for (unsigned int k=kmin; k<=kmax; k++){
-		temp += (*this)[k]*_deltaT;
+Interval Tube::integral(const int kmin, const int kmax) const {
+	assert(kmin>=0 && kmin<=kmax && kmax<size());
+	Interval res(0,0);
+	// bottom-up traversal of the nodes covering [kmin,kmax]
+	for (int l=size()+kmin, r=size()+kmax+1; l<r; l/=2, r/=2) {
+		if (l&1) res += _integ[l++];
+		if (r&1) res += _integ[--r];
 	}
-	return temp;
+	return res;
 }
 
 Tube& Tube::integral() {
-	IntervalVector temp = (*this);
+	Interval sum(0,0);
 	for(int i=0; i < size(); i++){
-		temp[i] = integral(0,i);
+		sum += (*this)[i]*_deltaT;
+		slice(i) = sum;
 	}
-	(*this) = temp;// FIXME A mon avis l'integral est à mettre dansun autre Tube: Tube integrate(const Tube& x)
+	build_tree();// FIXME A mon avis l'integral est à mettre dansun autre Tube: Tube integrate(const Tube& x)
 	return *this;
 }
 
@@ -369,17 +413,19 @@ Tube& Tube::shift(double delay) {
 	assert(delay<_tf);
 	int shifti = (int)round(delay/_deltaT);
 	for (int i = 0; i < size(); i++) {
-		if(i+shifti>=0 && i+shifti<size()) (*this)[i] = (*this)[i+shifti];
-		else (*this)[i] = Interval::ALL_REALS; // gch: not EMPTY_SET! a vector cannot contain
-		                                       // empty components if it is not empty itself.
+		if(i+shifti>=0 && i+shifti<size()) slice(i) = (*this)[i+shifti];
+		else slice(i) = Interval::ALL_REALS; // gch: not EMPTY_SET! a vector cannot contain
+		                                     // empty components if it is not empty itself.
 	}
 
+	build_tree();
 	return *this;
 }
 
 Tube& Tube::scale(double coef) {// FIXME A corriger pas robuste
 	_tf=(_tf-_t0)*coef+_t0;
 	_deltaT=_deltaT*coef;
+	build_tree();
 	return *this;
 }
 
@@ -408,5 +454,3 @@ std::ostream& operator <<(std::ostream& os, const Tube& x) {
 
 } // end namespace ibex
 
-
-#endif /* _IBEX_TUBE_H_ */
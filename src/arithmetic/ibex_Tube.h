@@ -9,10 +9,11 @@
  * Created     : Oct 7, 2013
  * ---------------------------------------------------------------------------- */
 
+#ifndef __IBEX_TUBE_H__
 #define __IBEX_TUBE_H__
-#ifndef __IBEX_TUBE_H__  // The class Tube is not ready !!!
 
 #include <cassert>
+#include <vector>
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_Function.h"
@@ -25,16 +26,53 @@ namespace ibex {
  *
  * \brief Tube
  *
+ * The slices (one interval per time step) are the components of the
+ * underlying interval vector. They are also the leaves of a balanced
+ * binary tree where each node stores the hull and the integral of
+ * the slices below it. This gives hull and integral queries over
+ * a range of time steps in O(log n) and point updates in O(log n).
+ *
+ * The interval vector is a protected base, so that a slice can only
+ * be modified via #set(int, const Interval&), the arithmetic operators
+ * or the contraction functions, which keep the tree up to date. The
+ * slices can be read as an interval vector with #slices().
  */
-class Tube : public IntervalVector {
+class Tube : protected IntervalVector {
 private:
 
 	double 			_t0;
 	double 			_tf;
 	double 			_deltaT;
 
+	/*
+	 * The tree is stored in arrays of size 2n: the leaves (the slices)
+	 * are the nodes n...2n-1 and the children of the node p are
+	 * 2p and 2p+1. The root is the node 1.
+	 */
+	std::vector<Interval> _hull;   // hull of the slices below each node
+	std::vector<Interval> _integ;  // integral of the slices below each node
+
+	/*
+	 * Write access to the ith slice. The tree must
+	 * be rebuilt afterwards (see #build_tree()).
+	 */
+	Interval& slice(int i);
+
+	/*
+	 * Rebuild the tree of slices. Complexity: O(n).
+	 */
+	void build_tree();
+
 public:
 
+	using IntervalVector::size;
+	using IntervalVector::is_empty;
+	using IntervalVector::is_unbounded;
+	using IntervalVector::lb;
+	using IntervalVector::ub;
+	using IntervalVector::mid;
+	using IntervalVector::diam;
+
 	/**
 	 * \brief Create a tube with default initialization.
 	 *
@@ -116,6 +154,9 @@ public:
 
 	/**
 	 * \brief Resize this Tube by changing the discretization step
+	 *
+	 * Each new slice is the hull of the former slices it overlaps.
+	 * Complexity: O(m log n) where m is the new number of slices.
 	 */
     void resample(double new_deltaT);
 
@@ -246,13 +287,30 @@ public:
 	const Interval& at(double ti) const;
 
 	/**
-	 * \brief Return f(t).
+	 * \brief Return the ith slice.
+	 */
+	const Interval& operator[](int i) const;
+
+	/**
+	 * \brief Return the slices.
+	 */
+	const IntervalVector& slices() const;
+
+	/**
+	 * \brief Set the ith slice to x.
 	 *
-	 * \return a reference to the value of the function at t=ti
+	 * Complexity: O(log n).
+	 */
+	void set(int i, const Interval& x);
+
+	/**
+	 * \brief Return the hull of the slices i1...i2 (included).
 	 *
-	 * \pre t0<=t<=tf.
+	 * Complexity: O(log n).
+	 *
+	 * \pre 0<=i1<=i2<size()
 	 */
-	Interval& at(double ti);
+	Interval hull(int i1, int i2) const;
 
 
 	/**
@@ -260,28 +318,11 @@ public:
 	 *
 	 * \return an enclosure of the function for the variable varying in [t]
 	 *
+	 * Complexity: O(log n).
+	 *
 	 * \pre t0<=t<=tf.
 	 */
     Interval at(const Interval &t) const;
-//
-//	/**
-//	 * \brief Return f(t_i)
-//	 *
-//	 * \return a const reference to the value of the function at the i^th time step.
-//	 *
-//	 * \pre 0<=i<=size()
-//	 */
-//	const Interval& operator[](int i) const;
-//
-//	/**
-//	 * \brief Return f(t_i)
-//	 *
-//	 * \return a const reference to the value of the function at the i^th time step.
-//	 *
-//	 * \pre 0<=i<=size()
-//	 */
-//
-//	Interval& operator[](int i);
 
 	/* \brief Return the maximal value of the tube (thus part of the upper bound).
 	 *
@@ -358,12 +399,17 @@ public:
     Tube& scale(double coef);
 
     /**
-     * \brief Return the integral of the  tube
+     * \brief Return the integral of the tube between
+     * the time steps kmin and kmax (included).
+     *
+     * Complexity: O(log n).
      */
-    Interval integral(const int kmin, const int kmax);
+    Interval integral(const int kmin, const int kmax) const;
 
     /**
-     * \brief Return the integral of the  tube
+     * \brief Replace the tube by its primitive (cumulated integral).
+     *
+     * Complexity: O(n).
      */
     Tube& integral();
 };
@@ -533,8 +579,16 @@ inline const Interval& Tube::at(double t) const {
 	return (*this)[(int)((t-_t0)/_deltaT)];
 }
 
-inline Interval& Tube::at(double t) {
-	return (*this)[(int)((t-_t0)/_deltaT)];
+inline const Interval& Tube::operator[](int i) const {
+	return IntervalVector::operator[](i);
+}
+
+inline const IntervalVector& Tube::slices() const {
+	return *this;
+}
+
+inline Interval& Tube::slice(int i) {
+	return IntervalVector::operator[](i);
 }
 
 inline Tube& Tube::ctcEq(const Tube& x) {
@@ -550,44 +604,52 @@ inline Tube Tube::operator|(const Tube& x) const {
 }
 
 inline Tube& Tube::operator+=(double x2) {
-	((IntervalVector&) (*this))+=x2;
+	for (int i=0; i<size();i++) slice(i) += x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator+=(const Interval& x2) {
-	for (int i=0; i<size();i++) (*this)[i] += x2;
+	for (int i=0; i<size();i++) slice(i) += x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator+=(const Tube& x2) {
 	__assert_tube_time_domain__(*this,x2);
 	((IntervalVector&) (*this))+=x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(double x2) {
-	((IntervalVector&) (*this))-=x2;
+	for (int i=0; i<size();i++) slice(i) -= x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(const Interval& x2) {
-	for (int i=0; i<size();i++) (*this)[i] -= x2;
+	for (int i=0; i<size();i++) slice(i) -= x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(const Tube& x2){
 	__assert_tube_time_domain__(*this,x2);
 	((IntervalVector&) (*this))-=x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator*=(double x2){
 	((IntervalVector&) (*this))*=x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator*=(const Interval& x2){
 	((IntervalVector&) (*this))*=x2;
+	build_tree();
 	return *this;
 }
 
@@ -598,24 +660,27 @@ inline Tube& Tube::operator*=(const Tube& x2){
 
 inline Tube& Tube::operator/=(double x2){
 	((IntervalVector&) (*this))*=1/x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator/=(const Interval& x2){
 	((IntervalVector&) (*this))*=1/x2;
+	build_tree();
 	return *this;
 }
 
 inline Tube& Tube::operator/=(const Tube& x2) {
 	__assert_tube_time_domain__(*this,x2);
 	for (int i = 0; i < size(); i++) {
-		((IntervalVector&) (*this))[i] /= x2[i];
+		slice(i) /= x2[i];
 	}
+	build_tree();
 	return *this;
 }
 
 inline Tube operator-(const Tube& x) {
-	return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),-x);
+	return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),-x.slices());
 }
 
 inline Tube operator+(const Tube& x1, const Tube& x2){
@@ -711,10 +776,14 @@ inline Tube operator/(const Interval& x1, const Tube& x2) {
 		for (int i=0;i<x.size();i++) {vec[i]=f(x[i],p);} \
 		return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),vec);
 
+/* function evaluated in a batch (see ibex_IntervalVector.h) */
+#define func_batch_binary_tube(f) \
+		return Tube(x.get_t0(),x.get_tF(),x.get_delta_t(),f(x.slices(),p));
+
 inline Tube abs(const Tube& x)           { func_unary_tube(abs) }
 inline Tube sqr(const Tube& x)           { func_unary_tube(sqr) }
 inline Tube sqrt(const Tube& x)          { func_unary_tube(sqrt)}
-inline Tube pow(const Tube& x, int p)    { func_binary_tube(pow) }
+inline Tube pow(const Tube& x, int p)    { func_batch_binary_tube(pow) }
 inline Tube pow(const Tube& x, double p) { func_binary_tube(pow) }
 inline Tube pow(const Tube &x, const Interval &p) { func_binary_tube(pow) }
 inline Tube root(const Tube& x, int p)   { func_binary_tube(root) }
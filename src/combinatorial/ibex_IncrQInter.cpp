@@ -0,0 +1,163 @@
+//============================================================================
+//                                  I B E X
+// File        : Incremental q-intersection
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_IncrQInter.h"
+#include "ibex_QInter.h"
+
+namespace ibex {
+
+namespace {
+
+inline double clip(double x, const Interval& h) {
+	return x<h.lb()? h.lb() : (x>h.ub()? h.ub() : x);
+}
+
+}
+
+IncrQInter::IncrQInter(int n, int p) : n(n), boxes(p, IntervalVector::empty(n)), lb(n), ub(n),
+		nb_non_empty(0), alive(p,0) {
+
+}
+
+void IncrQInter::set(int j, const IntervalVector& box) {
+	assert(box.size()==n);
+
+	IntervalVector& b=boxes[j];
+
+	if (!b.is_empty()) {
+		for (int i=0; i<n; i++) {
+			lb[i].erase(std::make_pair(b[i].lb(),j));
+			ub[i].erase(std::make_pair(b[i].ub(),j));
+		}
+		nb_non_empty--;
+	}
+
+	b=box;
+
+	if (!b.is_empty()) {
+		for (int i=0; i<n; i++) {
+			lb[i].insert(std::make_pair(b[i].lb(),j));
+			ub[i].insert(std::make_pair(b[i].ub(),j));
+		}
+		nb_non_empty++;
+	}
+}
+
+bool IncrQInter::projection_1d(int i, int q, const Interval& h, Interval& res) const {
+	// Same algorithm as in qinter_projf, but the bounds are already sorted.
+	// The bounds of the boxes are clipped to h (this does not change the order).
+
+	// lowest point x that belongs to q intervals
+	Bounds::const_iterator itl=lb[i].begin();
+	Bounds::const_iterator itu=ub[i].begin();
+	int seen=0;   // number of intervals with lb<=x
+	int before=0; // number of intervals with ub<x
+	double l=0;
+	for (; itl!=lb[i].end(); itl++) {
+		if (!alive[itl->second]) continue;
+		l=clip(itl->first,h);
+		seen++;
+		while (itu!=ub[i].end() && (!alive[itu->second] || clip(itu->first,h)<l)) {
+			if (alive[itu->second]) before++;
+			itu++;
+		}
+		if (seen-before>=q) break;
+	}
+	if (itl==lb[i].end()) return false;
+
+	// uppest point
+	Bounds::const_reverse_iterator rtu=ub[i].rbegin();
+	Bounds::const_reverse_iterator rtl=lb[i].rbegin();
+	int after=0;  // number of intervals with lb>x
+	double u=0;
+	seen=0;
+	for (; rtu!=ub[i].rend(); rtu++) {
+		if (!alive[rtu->second]) continue;
+		u=clip(rtu->first,h);
+		seen++;
+		while (rtl!=lb[i].rend() && (!alive[rtl->second] || clip(rtl->first,h)>u)) {
+			if (alive[rtl->second]) after++;
+			rtl++;
+		}
+		if (seen-after>=q) break;
+	}
+	assert(rtu!=ub[i].rend());
+
+	res=Interval(l,u);
+	return true;
+}
+
+IntervalVector IncrQInter::projection(int q) {
+	int p=size();
+
+	alive_list.clear();
+	for (int j=0; j<p; j++) {
+		alive[j]=!boxes[j].is_empty();
+		if (alive[j]) alive_list.push_back(j);
+	}
+
+	IntervalVector h(n);
+
+	if (nb_non_empty==0 || nb_non_empty<q) {
+		h.set_empty();
+		return h;
+	}
+
+	for (int i=0; i<n; i++)
+		h[i]=Interval(lb[i].begin()->first, ub[i].rbegin()->first);
+
+	if (q<=0) return h;
+
+	Interval res;
+	// number of dimensions processed since the last reduction
+	int fix=0;
+
+	for (int i=0; fix<n; i=(i+1)%n) {
+		if (!projection_1d(i,q,h[i],res)) {
+			h.set_empty();
+			return h;
+		}
+
+		if (res==h[i]) {
+			fix++;
+			continue;
+		}
+		fix=1;
+		h[i]=res;
+
+		// discard the boxes that do not intersect the new bounds
+		std::vector<int>::iterator last=alive_list.begin();
+		for (std::vector<int>::iterator it=alive_list.begin(); it!=alive_list.end(); it++) {
+			if (boxes[*it][i].intersects(res)) *(last++)=*it;
+			else alive[*it]=0;
+		}
+		alive_list.erase(last,alive_list.end());
+
+		if ((int) alive_list.size()<q) {
+			h.set_empty();
+			return h;
+		}
+	}
+	return h;
+}
+
+IntervalVector IncrQInter::hull(int q) {
+	IntervalVector h=projection(q);
+
+	if (h.is_empty() || q<=1) return h;
+
+	Array<IntervalVector> refs(alive_list.size());
+	for (unsigned int k=0; k<alive_list.size(); k++)
+		refs.set_ref(k,boxes[alive_list[k]]);
+
+	return qinter2(refs,q);
+}
+
+} // end namespace ibex
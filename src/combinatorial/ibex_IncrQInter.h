@@ -0,0 +1,104 @@
+//============================================================================
+//                                  I B E X
+// File        : Incremental q-intersection
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_INCR_Q_INTER_H__
+#define __IBEX_INCR_Q_INTER_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+#include <set>
+
+namespace ibex {
+
+/**
+ * \ingroup combinatorial
+ * \brief Incremental q-intersection.
+ *
+ * A set of p boxes that can be modified one by one and whose q-intersection
+ * can be calculated at any time.
+ *
+ * The bounds of the boxes are kept sorted in each dimension (balanced trees),
+ * so that the modification of a box costs O(n.log(p)) and the one-dimensional
+ * q-intersections of the projection algorithm (see #projection(int)) are
+ * obtained by walking the sorted bounds and counting the boxes that cover
+ * the current point, in O(p), instead of sorting the 2p bounds again.
+ */
+class IncrQInter {
+public:
+	/**
+	 * \brief Create a set of p boxes of dimension n.
+	 *
+	 * All the boxes are initially empty.
+	 */
+	IncrQInter(int n, int p);
+
+	/**
+	 * \brief Dimension of the boxes.
+	 */
+	int nb_var() const;
+
+	/**
+	 * \brief Number of boxes.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Replace the jth box.
+	 */
+	void set(int j, const IntervalVector& box);
+
+	/**
+	 * \brief The jth box.
+	 */
+	const IntervalVector& operator[](int j) const;
+
+	/**
+	 * \brief Q-intersection - OUTER APPROXIMATION - Projection algorithm.
+	 *
+	 * Same result as #ibex::qinter_projf(const Array<IntervalVector>&, int) applied to the boxes.
+	 */
+	IntervalVector projection(int q);
+
+	/**
+	 * \brief Q-intersection - EXACT.
+	 *
+	 * Same result as #ibex::qinter2(const Array<IntervalVector>&, int) applied to the boxes.
+	 * The exact algorithm is only run on the boxes that are not discarded by #projection(int).
+	 */
+	IntervalVector hull(int q);
+
+protected:
+	typedef std::set<std::pair<double,int> > Bounds;
+
+	/* one-dimensional q-intersection of the alive boxes, intersected with hull[i] */
+	bool projection_1d(int i, int q, const Interval& h, Interval& res) const;
+
+	int n;
+	std::vector<IntervalVector> boxes;
+	std::vector<Bounds> lb;       // sorted lower bounds (and box number) of the non-empty boxes in each dimension
+	std::vector<Bounds> ub;       // sorted upper bounds
+	int nb_non_empty;             // number of non-empty boxes
+
+	std::vector<char> alive;      // boxes not discarded by the last projection
+	std::vector<int> alive_list;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int IncrQInter::nb_var() const { return n; }
+
+inline int IncrQInter::size() const { return boxes.size(); }
+
+inline const IntervalVector& IncrQInter::operator[](int j) const { return boxes[j]; }
+
+} // end namespace ibex
+
+#endif // __IBEX_INCR_Q_INTER_H__
@@ -10,11 +10,224 @@
 
 #include "ibex_QInter.h"
 #include <algorithm>
+#include <vector>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * One-dimensional q-intersection of the intervals [lb[j],ub[j]].
+ * The vectors are sorted in place. Return false if the q-intersection is empty.
+ */
+bool qinter_1d(std::vector<double>& lb, std::vector<double>& ub, int q, Interval& res) {
+	int p=lb.size();
+
+	sort(lb.begin(),lb.end());
+	sort(ub.begin(),ub.end());
+
+	// lowest point x that belongs to q intervals:
+	// x is the lower bound of the (i+1)th interval and no more
+	// than i+1-q intervals are before x.
+	int before=0; // number of intervals with ub<lb[i]
+	int i=q-1;
+	for (; i<p; i++) {
+		while (ub[before]<lb[i]) before++;
+		if (i+1-before>=q) break;
+	}
+	if (i==p) return false;
+	double l=lb[i];
+
+	// symmetric
+	int after=0;  // number of intervals with lb>ub[p-1-i]
+	for (i=q-1; i<p; i++) {
+		while (lb[p-1-after]>ub[p-1-i]) after++;
+		if (i+1-after>=q) break;
+	}
+	assert(i<p);
+	res=Interval(l,ub[p-1-i]);
+	return true;
+}
+
+/*
+ * Projection fixpoint. Returns the hull and the non-empty
+ * boxes that intersect it in "alive".
+ */
+IntervalVector proj_fixpoint(const Array<IntervalVector>& boxes, int q, std::vector<int>& alive) {
+	int n=boxes[0].size();
+
+	IntervalVector hull(IntervalVector::empty(n));
+
+	alive.clear();
+	for (int j=0; j<boxes.size(); j++) {
+		if (!boxes[j].is_empty()) {
+			alive.push_back(j);
+			hull |= boxes[j];
+		}
+	}
+
+	if ((int) alive.size()<q || q<=0) {
+		if (q>0) hull.set_empty();
+		return hull;
+	}
+
+	std::vector<double> lb, ub;
+	Interval res;
+	// number of dimensions processed since the last reduction
+	int fix=0;
+
+	for (int i=0; fix<n; i=(i+1)%n) {
+		lb.clear();
+		ub.clear();
+		for (std::vector<int>::const_iterator it=alive.begin(); it!=alive.end(); it++) {
+			Interval x=boxes[*it][i] & hull[i];
+			lb.push_back(x.lb());
+			ub.push_back(x.ub());
+		}
+
+		if (!qinter_1d(lb,ub,q,res)) {
+			hull.set_empty();
+			return hull;
+		}
+
+		if (res==hull[i]) {
+			fix++;
+			continue;
+		}
+		fix=1;
+		hull[i]=res;
+
+		// remove the boxes that do not intersect the new bounds
+		std::vector<int>::iterator last=alive.begin();
+		for (std::vector<int>::iterator it=alive.begin(); it!=alive.end(); it++) {
+			if (boxes[*it][i].intersects(res)) *(last++)=*it;
+		}
+		alive.erase(last,alive.end());
+
+		if ((int) alive.size()<q) {
+			hull.set_empty();
+			return hull;
+		}
+	}
+
+	return hull;
+}
+
+/*
+ * Sweep of the grid, with counting.
+ */
+class QInterSweep {
+public:
+	QInterSweep(const std::vector<IntervalVector>& boxes, int q);
+
+	/*
+	 * True if a cell of the slab "k" of the dimension d
+	 * is contained in q boxes.
+	 */
+	bool slab(int d, int k);
+
+	const std::vector<IntervalVector>& boxes;
+	int n;
+	int p;
+	int q;
+	std::vector<std::vector<double> > x;    // sorted bounds in each dimension
+	std::vector<std::vector<int> > active; // boxes containing the current slab at each level
+	int d;                                 // dimension swept first
+
+private:
+	/* one-dimensional q-intersection of the active boxes in dimension i */
+	bool project(int level, int i, Interval& res);
+
+	std::vector<double> lb, ub;            // bounds in one dimension
+	bool sweep(int level);
+	void filter(int level, int k);
+};
+
+QInterSweep::QInterSweep(const std::vector<IntervalVector>& boxes, int q) : boxes(boxes),
+		n(boxes[0].size()), p(boxes.size()), q(q), x(n), active(n+1), d(0) {
+
+	for (int i=0; i<n; i++) {
+		for (int j=0; j<p; j++) {
+			x[i].push_back(boxes[j][i].lb());
+			x[i].push_back(boxes[j][i].ub());
+		}
+		sort(x[i].begin(),x[i].end());
+	}
+
+	for (int j=0; j<p; j++) active[0].push_back(j);
+}
+
+void QInterSweep::filter(int level, int k) {
+	int i=(d+level)%n;
+	// midpoint of the kth cell (same test as the grid algorithm)
+	double mid=Interval(x[i][k],x[i][k+1]).mid();
+	std::vector<int>& next=active[level+1];
+	next.clear();
+	for (std::vector<int>::const_iterator it=active[level].begin(); it!=active[level].end(); it++)
+		if (boxes[*it][i].contains(mid)) next.push_back(*it);
+}
+
+bool QInterSweep::slab(int _d, int k) {
+	d=_d;
+	filter(0,k);
+	return (int) active[1].size()>=q && sweep(1);
+}
+
+bool QInterSweep::project(int level, int i, Interval& res) {
+	lb.clear();
+	ub.clear();
+	for (std::vector<int>::const_iterator it=active[level].begin(); it!=active[level].end(); it++) {
+		lb.push_back(boxes[*it][i].lb());
+		ub.push_back(boxes[*it][i].ub());
+	}
+	return qinter_1d(lb,ub,q,res);
+}
+
+bool QInterSweep::sweep(int level) {
+	if (level==n) return true;
+
+	Interval res;
+	std::vector<int>& a=active[level];
+
+	// projection fixpoint in the remaining dimensions: the
+	// active boxes that do not intersect the one-dimensional
+	// q-intersections are removed.
+	int fix=0;
+	for (int l=n-1; fix<n-level; l=(l==level? n-1 : l-1)) {
+		int i=(d+l)%n;
+		if (!project(level,i,res)) return false;
+		int size=a.size();
+		std::vector<int>::iterator last=a.begin();
+		for (std::vector<int>::iterator it=a.begin(); it!=a.end(); it++) {
+			if (boxes[*it][i].intersects(res)) *(last++)=*it;
+		}
+		a.erase(last,a.end());
+		if ((int) a.size()<q) return false;
+		if ((int) a.size()==size) fix++;
+		else fix=1;
+	}
+
+	if (level==n-1) return true;
+
+	// only the cells of the q-intersection in the
+	// current dimension are swept.
+	int i=(d+level)%n;
+	project(level,i,res);
+	int kmin=lower_bound(x[i].begin(),x[i].end(),res.lb())-x[i].begin();
+	// note: the upper bound appears at least twice if the q-intersection is degenerated
+	int kmax=upper_bound(x[i].begin(),x[i].end(),res.ub())-x[i].begin()-1;
+
+	for (int k=kmin; k<kmax; k++) {
+		filter(level,k);
+		if ((int) active[level+1].size()>=q && sweep(level+1)) return true;
+	}
+	return false;
+}
+
+} // end anonymous namespace
+
 IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	assert(_boxes.size()>0);
 	int n=_boxes[0].size();
@@ -156,4 +369,53 @@ IntervalVector qinter(const Array<IntervalVector>& _boxes, int q) {
 	return inner_box;
 }
 
+IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
+	assert(_boxes.size()>0);
+
+	std::vector<int> alive;
+	IntervalVector hull=proj_fixpoint(_boxes,q,alive);
+
+	if (hull.is_empty() || q<=1) return hull;
+
+	int n=hull.size();
+
+	std::vector<IntervalVector> boxes;
+	for (std::vector<int>::const_iterator it=alive.begin(); it!=alive.end(); it++)
+		boxes.push_back(_boxes[*it] & hull);
+
+	QInterSweep sweep(boxes,q);
+	int k=2*boxes.size()-1; // number of cells in a dimension
+
+	IntervalVector res(n);
+
+	for (int d=0; d<n; d++) {
+
+		/*===================== calculate lower bound =========================== */
+		int i=0;
+		while (i<k && !sweep.slab(d,i)) i++;
+
+		if (i==k) {
+			// can only happen for d==0
+			res.set_empty();
+			return res;
+		}
+		double lb0=sweep.x[d][i];
+
+		/*===================== calculate upper bound =========================== */
+		i=k-1;
+		while (!sweep.slab(d,i)) i--;
+
+		res[d]=Interval(lb0,sweep.x[d][i+1]);
+	}
+
+	return res;
+}
+
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q) {
+	assert(boxes.size()>0);
+
+	std::vector<int> alive;
+	return proj_fixpoint(boxes,q,alive);
+}
+
 } // end namespace ibex
@@ -32,6 +32,43 @@ namespace ibex {
  */
 IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - EXACT - Sweep algorithm
+ *
+ * Same result as #qinter(const Array<IntervalVector>&, int) but much faster
+ * with many boxes:
+ * <ul>
+ * <li> the boxes are first reduced by the projection algorithm
+ *      (see #qinter_projf(const Array<IntervalVector>&, int)): the boxes that do not intersect
+ *      the projection are removed and the other ones are intersected with it;
+ * <li> for each dimension, the cells of the grid are swept dimension by dimension as
+ *      in the grid algorithm, but the boxes that contain the current slab of each
+ *      dimension are counted as the sweep goes deeper. A whole slab is skipped
+ *      as soon as it is contained in less than q boxes, and the boxes of a slab
+ *      are reduced again by the projection algorithm in the remaining dimensions.
+ *      In the last dimension, the cells are not swept: the one-dimensional
+ *      q-intersection is calculated directly.
+ * </ul>
+ *
+ * The problem is NP-hard, so the time remains exponential in the
+ * dimension in the worst case.
+ */
+IntervalVector qinter2(const Array<IntervalVector>& boxes, int q);
+
+/**
+ * \ingroup combinatorial
+ * \brief Q-intersection - OUTER APPROXIMATION - Projection algorithm
+ *
+ * Fixpoint of the one-dimensional q-intersections: in each dimension, the
+ * q-intersection of the intervals is calculated with a sweep of the sorted bounds
+ * (O(p.log(p)) for p boxes); the boxes that do not intersect the result are removed
+ * and the next dimension is processed, until no bound is improved.
+ *
+ * The result contains the q-intersection.
+ */
+IntervalVector qinter_projf(const Array<IntervalVector>& boxes, int q);
+
 } // end namespace ibex
 
 
@@ -11,8 +11,31 @@
 
 #include "ibex_Ctc3BCid.h"
 
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
 namespace ibex {
 
+namespace {
+
+/*
+ * The kth slice of width w of x (among n).
+ * The last slice is enlarged up to the upper bound of x.
+ */
+Interval slice(const Interval& x, int k, int n, double w) {
+	double inf_k = x.lb()+k*w;
+	double sup_k = x.lb()+(k+1)*w;
+	if (sup_k > x.ub() || (k == n-1 && sup_k<x.ub())) sup_k = x.ub();
+	return Interval(inf_k, sup_k);
+}
+
+} // end anonymous namespace
+
 const int Ctc3BCid::default_s3b = 10;
 const int Ctc3BCid::default_scid = 1;
 const double Ctc3BCid::default_var_min_width = 1.e-11;
@@ -39,6 +62,41 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 
+void Ctc3BCid::set_parallel(const Array<Ctc>& ctcs) {
+	clones.clear();      // (no deletion by resize)
+	clones.resize(ctcs.size());
+	for (int i=0; i<ctcs.size(); i++) {
+		assert(ctcs[i].nb_var==ctc.nb_var);
+		clones.set_ref(i,ctcs[i]);
+	}
+}
+
+int Ctc3BCid::nb_slices_at_once() const {
+#ifdef _OPENMP
+	if (clones.size()>0)
+		return std::min(clones.size(), omp_get_max_threads());
+#endif
+	return 1;
+}
+
+void Ctc3BCid::contract_slices(vector<IntervalVector>& slices, vector<char>& refuted, int n) {
+
+#pragma omp parallel for schedule(dynamic) num_threads(nb_slices_at_once()) if (n>1)
+	for (int i=0; i<n; i++) {
+		int t=0;
+#ifdef _OPENMP
+		t=omp_get_thread_num();
+#endif
+		Ctc& c=clones.is_empty()? ctc : clones[t];
+		try {
+			c.contract(slices[i],impact);              // [gch] only "var" is set in "impact".
+			refuted[i]=0;
+		} catch(EmptyBoxException&) {
+			refuted[i]=1;
+		}
+	}
+}
+
 int Ctc3BCid::limitCIDDichotomy ()  {
 	return LimitCIDDichotomy;
 }
@@ -226,91 +284,95 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
 
 	IntervalVector savebox(box);
+	Interval initdom(dom);
+
+	// The slices are contracted by groups of "nb" slices
+	// (only one in sequential mode). The results are read
+	// in the order of the sequential algorithm.
+	int nb=nb_slices_at_once();
+	vector<IntervalVector> slices(nb, savebox);
+	vector<char> refuted(nb);
 
 	// Reduce left bound by shaving:
 
-	bool stopLeft = false;
-	double leftBound = dom.lb();
-	double rightBound = dom.ub();
+	double leftBound = initdom.lb();
+	double rightBound = initdom.ub();
 	double leftCID=0.;
 
-	int k=0;
+	int kLeft=-1;                                      // first slice (from the left) not refuted
 
-	while (k < locs3b && ! stopLeft) {
+	for (int k0=0; k0<locs3b && kLeft==-1; k0+=nb) {
 
-		// Compute a slice 'dom'
-		if (k > 0) box = savebox;
-		double inf_k = dom.lb()+k*w_DC;
-		double sup_k = dom.lb()+(k+1)*w_DC;
-		if (sup_k > dom.ub() || (k == locs3b - 1 && sup_k<dom.ub())) sup_k = dom.ub();
-		dom = Interval(inf_k, sup_k);
+		int n=std::min(nb, locs3b-k0);
 
-		// Try to refute this slice
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		} catch(EmptyBoxException& e) {
-			leftBound = sup_k;
-			k++;
-			continue;
+		// Compute the slices
+		for (int i=0; i<n; i++) {
+			slices[i]=savebox;
+			slices[i][var]=slice(initdom, k0+i, locs3b, w_DC);
+		}
+
+		// Try to refute these slices
+		contract_slices(slices, refuted, n);
+
+		for (int i=0; i<n && kLeft==-1; i++) {
+			double sup_k=slice(initdom, k0+i, locs3b, w_DC).ub();
+			if (refuted[i])
+				leftBound = sup_k;
+			else {                                     // non empty box
+				kLeft = k0+i;
+				leftCID = sup_k;
+				leftBound = slices[i][var].lb();
+				box = slices[i];
+			}
 		}
-		//non empty box
-		stopLeft = true;
-		leftCID = sup_k;
-		leftBound = dom.lb();
-		k++;
 	}
 
-	if (!stopLeft) {                                   // all slices give an empty box
+	if (kLeft==-1) {                                   // all slices give an empty box
 		box.set_empty();
 		throw EmptyBoxException();
-	} else if (k == locs3b) {
+	} else if (kLeft == locs3b-1) {
 		// Only the last slice gives a non-empty box : box is reduced to this last slice
 		return true;
 	} else {
 
 		IntervalVector newbox (box);                   // newbox is initialized with the last slice handled in the previous loop
-		int kLeft = k-1;
 
 		// Reduce right bound by shaving:
-		bool stopRight = false;
 		double lastInf_k=0.;
 
-		int k2 = locs3b - 1;
+		int kRight=-1;                                 // first slice (from the right) not refuted
 
-		while (k2 > kLeft && ! stopRight) {
+		for (int k0=locs3b-1; k0>kLeft && kRight==-1; k0-=nb) {
 
-			// Compute slice
-			box = savebox;
-			double inf_k = dom.lb() + k2 * w_DC;
-			double sup_k = dom.lb() + (k2+1) * w_DC;
-			if (sup_k > dom.ub() || (k2 == locs3b - 1 && sup_k < dom.ub())) sup_k = dom.ub();
+			int n=std::min(nb, k0-kLeft);
 
-			dom = Interval(inf_k, sup_k);
-
-			// Try to refute the slice
-			try {
-				ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-			} catch(EmptyBoxException& e) {
-				rightBound = sup_k;
-				k2--;
-				continue;
+			// Compute the slices
+			for (int i=0; i<n; i++) {
+				slices[i]=savebox;
+				slices[i][var]=slice(initdom, k0-i, locs3b, w_DC);
 			}
 
-			stopRight = true;
-			lastInf_k = inf_k;
-			rightBound = dom.ub();
-
-			k2--;
-
+			// Try to refute these slices
+			contract_slices(slices, refuted, n);
+
+			for (int i=0; i<n && kRight==-1; i++) {
+				Interval dom_k=slice(initdom, k0-i, locs3b, w_DC);
+				if (refuted[i])
+					rightBound = dom_k.ub();
+				else {
+					kRight = k0-i;
+					lastInf_k = dom_k.lb();
+					rightBound = slices[i][var].ub();
+					box = slices[i];
+				}
+			}
 		}
 
-		if (!stopRight) {                              // All the boxes visited in the second loop give an empty box
+		if (kRight==-1) {                              // All the boxes visited in the second loop give an empty box
 			box = newbox;
 			return true;
 		} else {
 
-			int kRight = k2 +1;
-
 			if (kLeft + 1 == kRight) {                 // No slice between the last handled left and right slices
 				box = box | newbox;
 				return true;
@@ -339,28 +401,33 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 
 	if(scid==0 || equalBoxes (var, varcid_box, var3Bcid_box)) return false;
 
-	IntervalVector box=varcid_box;
-	Interval& dom(box[var]);
+	Interval dom(varcid_box[var]);
+
+	int nb=nb_slices_at_once();
+	vector<IntervalVector> slices(std::min(nb,scid), varcid_box);
+	vector<char> refuted(slices.size());
 
 	double w_DC = dom.diam() / scid;
-	for (int k = 0 ; k < scid ; k++) {
-		if(k>0) box=varcid_box;
-		// compute slice:
-		double inf_k = dom.lb() + k * w_DC;
-		double sup_k = dom.lb() + (k+1) * w_DC;
-		if (sup_k > dom.ub() || (k == scid-1 && sup_k < dom.ub())) sup_k = dom.ub();
-		dom = Interval(inf_k, sup_k);
+	for (int k0 = 0 ; k0 < scid ; k0+=nb) {
 
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		}
-		catch(EmptyBoxException& e) {
-			continue;                                  // the current slice is infeasible : nothing to add to the hull
+		int n=std::min(nb, scid-k0);
+
+		// compute slices:
+		for (int i=0; i<n; i++) {
+			slices[i]=varcid_box;
+			slices[i][var]=slice(dom, k0+i, scid, w_DC);
 		}
 
-		var3Bcid_box |= box;                           // add box to the hull
-		if(equalBoxes (var, varcid_box, var3Bcid_box))
-			return false;                              // VarCID was useless
+		contract_slices(slices, refuted, n);
+
+		for (int i=0; i<n; i++) {
+			if (refuted[i])
+				continue;                              // the current slice is infeasible : nothing to add to the hull
+
+			var3Bcid_box |= slices[i];                 // add box to the hull
+			if(equalBoxes (var, varcid_box, var3Bcid_box))
+				return false;                          // VarCID was useless
+		}
 	}
 
 	return true;
@@ -14,6 +14,9 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -113,6 +116,31 @@ class Ctc3BCid : public Ctc {
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Shave in parallel.
+	 *
+	 * The slices of a variable (left/right shaving and CID) are contracted
+	 * concurrently, each thread using its own copy of the sub-contractor.
+	 * The slices are handled by groups of as many slices as threads, in the
+	 * order of the sequential algorithm (e.g., the left shaving contracts the next
+	 * group of left slices) and the results are read in this order too. So the contraction
+	 * is exactly the same as in sequential mode; the only extra work is the contraction of
+	 * the slices of a group beyond the one that stops the shaving.
+	 *
+	 * This holds as long as the result of the sub-contractor only depends on the box
+	 * and the impact. This is not the case, e.g., of a #ibex::CtcPropag with #ibex::CtcPropag::priority
+	 * set, whose agenda is ordered with statistics on the previous calls.
+	 *
+	 * \param ctcs - Copies of #ctc, one per thread. The copies must not share any data
+	 *               modified by a contraction (in particular, they must not be built on
+	 *               the same functions; see #ibex::System::System(const System&, copy_mode)).
+	 *               An empty array restores the sequential mode.
+	 *
+	 * \note The slices are only contracted concurrently if OpenMP is enabled
+	 * (see the --with-openmp option). Otherwise they are contracted one by one.
+	 */
+	void set_parallel(const Array<Ctc>& ctcs);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
@@ -209,6 +237,17 @@ class Ctc3BCid : public Ctc {
 	 */
 	bool equalBoxes (int var, IntervalVector &box1, IntervalVector &box2);
 
+	/**
+	 * Number of slices contracted at once (1 in sequential mode).
+	 */
+	int nb_slices_at_once() const;
+
+	/**
+	 * Contracts the \a n first boxes of \a slices with the sub-contractor (or
+	 * its copies in parallel mode). refuted[i] is set to 1 iff the ith box is empty.
+	 */
+	void contract_slices(std::vector<IntervalVector>& slices, std::vector<char>& refuted, int n);
+
 	/** The maximum number of slices that the contractor will try to refute **/
 	int s3b;
 
@@ -228,6 +267,9 @@ class Ctc3BCid : public Ctc {
 	 * Allow to benefit from the incrementality of the sub-contractor. */
 	BitSet impact;
 
+	/** Copies of the sub-contractor for the parallel mode (empty in sequential mode). */
+	Array<Ctc> clones;
+
 	virtual int limitCIDDichotomy () ;
 	
 };
@@ -9,19 +9,46 @@
 //============================================================================
 
 #include "ibex_CtcAcid.h"
+#include "ibex_Expr.h"
+#include "ibex_NodeMap.h"
+#include "ibex_ExprTag.h"
+
 #include <algorithm>
+#include <fstream>
+#include <sstream>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+const int nbinitcalls=50;                              // longueur du réglage
+const int factor = 20;                                 // détermine la période entre les débuts de 2 régalages  successifs : factor*nbinitcalls
+
+// FNV-1a (32 bits), the value is hashed byte by byte
+void combine(uint32_t& h, uint32_t v) {
+	for (int i=0; i<4; i++, v>>=8) {
+		h ^= (v & 0xff);
+		h *= 16777619U;
+	}
+}
+
+void combine(uint32_t& h, const Dim& d) {
+	combine(h, (uint32_t) d.type());
+	combine(h, (uint32_t) d.dim2);
+	combine(h, (uint32_t) d.dim3);
+}
+
+} // end anonymous namespace
+
 double  CtcAcid::nbvarstat=0;
 //const double CtcAcid::default_ctratio=0.005;
 const double CtcAcid::default_ctratio=0.002;
 
 CtcAcid::CtcAcid(const System& sys, const BitSet& cid_vars, Ctc& ctc, bool optim, int s3b, int scid,
 		double var_min_width, double ct_ratio): Ctc3BCid (cid_vars,ctc,s3b,scid,cid_vars.size(),var_min_width),
-		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio),  nbcidvar(0), nbtuning(0), optim(optim)  {
+		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio),  nbcidvar(0), nbtuning(0), optim(optim) {
 	// [gch] BNE check the argument "cid_vars.nb_set()" given to _3BCID
 }
 
@@ -37,8 +64,6 @@ void CtcAcid::contract(IntervalVector& box) {
 	int nbvarmax=5*nb_CID_var;                         //  au plus 5*nbvar
 	double *ctstat = new double[nbvarmax];
 
-	int nbinitcalls=50;                                // longueur du réglage
-	int factor = 20;                                   // détermine la période entre les débuts de 2 régalages  successifs : factor*nbinitcalls
 	int nbcall1= nbcalls% (factor*nbinitcalls);        // pour savoir si on est dans une phase de réglage (nbcall1 < nbinitcalls )
 
 	IntervalVector initbox (box);
@@ -101,6 +126,7 @@ void CtcAcid::contract(IntervalVector& box) {
 	if (nbcall1==nbinitcalls) {                        // fin de la phase de réglage  - détermination de nbcidvar
 		nbcidvar= (int) (nbctvar + 0.5);               // - calcul incrémental de la moyenne
 		nbtuning++;
+		trajectory.push_back(nbcidvar);
 		nbvarstat = (nbvarstat * (nbtuning-1) + nbcidvar) / nbtuning;
 	}
 
@@ -200,4 +226,113 @@ double CtcAcid::nbvar_stat() {
 	return nbvarstat;
 }
 
+uint32_t CtcAcid::structural_hash(const System& sys) {
+	uint32_t h=2166136261U;
+	ExprTag tag;
+
+	combine(h, (uint32_t) sys.nb_var);
+	combine(h, (uint32_t) sys.nb_ctr);
+
+	for (int c=0; c<sys.nb_ctr; c++) {
+		const Function& f=sys.ctrs[c].f;
+		combine(h, (uint32_t) sys.ctrs[c].op);
+
+		// nodes are identified by their rank in the function
+		NodeMap<int> rank;
+		for (int k=0; k<f.nb_nodes(); k++)
+			rank.insert(f.node(k),k);
+
+		for (int k=0; k<f.nb_nodes(); k++) {
+			const ExprNode& e=f.node(k);
+			combine(h, tag.get(e));
+			combine(h, e.dim);
+
+			if (const ExprSymbol* x=dynamic_cast<const ExprSymbol*>(&e))
+				combine(h, (uint32_t) x->key);
+			else if (const ExprIndex* i=dynamic_cast<const ExprIndex*>(&e)) {
+				combine(h, (uint32_t) i->index);
+				combine(h, (uint32_t) rank[i->expr]);
+			} else if (const ExprNAryOp* n=dynamic_cast<const ExprNAryOp*>(&e)) {
+				for (int j=0; j<n->nb_args; j++)
+					combine(h, (uint32_t) rank[n->arg(j)]);
+			} else if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e)) {
+				combine(h, (uint32_t) rank[b->left]);
+				combine(h, (uint32_t) rank[b->right]);
+			} else if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e)) {
+				if (const ExprPower* p=dynamic_cast<const ExprPower*>(&e))
+					combine(h, (uint32_t) p->expon);
+				combine(h, (uint32_t) rank[u->expr]);
+			}
+			// note: the value of a constant is ignored
+		}
+	}
+	return h;
+}
+
+void CtcAcid::save_tuning(const char* filename) const {
+	std::ofstream out_file;
+	out_file.open(filename, ios::out | ios::trunc);
+
+	if (out_file.fail()) {
+		std::stringstream s;
+		s << "CtcAcid [save_tuning]: cannot open file " << filename << " for dumping data";
+		ibex_error(s.str().c_str());
+	}
+
+	out_file.imbue(std::locale::classic());
+
+	out_file << "SYSTEM " << structural_hash(system);
+	out_file << "\nNB_VAR " << nb_var;
+	out_file << "\nNBCIDVAR " << nbcidvar;
+	out_file << "\nNBTUNING " << nbtuning;
+	out_file << "\nTRAJECTORY " << trajectory.size();
+	for (unsigned int i=0; i<trajectory.size(); i++) out_file << " " << trajectory[i];
+	out_file << "\n";
+
+	out_file.close();
+}
+
+bool CtcAcid::load_tuning(const char* filename) {
+	std::ifstream in_file;
+	in_file.open(filename, ios::in);
+
+	// a missing or bad file is ignored (the default tuning is kept)
+	if (in_file.fail()) return false;
+
+	in_file.imbue(std::locale::classic());
+
+	std::string kw[5];
+	unsigned long hash;
+	int n, cidvar, tuning, size;
+
+	in_file >> kw[0] >> hash >> kw[1] >> n >> kw[2] >> cidvar >> kw[3] >> tuning >> kw[4] >> size;
+
+	if (in_file.fail() || kw[0]!="SYSTEM" || kw[1]!="NB_VAR" || kw[2]!="NBCIDVAR"
+			|| kw[3]!="NBTUNING" || kw[4]!="TRAJECTORY")
+		return false;
+
+	if (hash!=structural_hash(system) || n!=nb_var || cidvar<0 || tuning<0 || size<0)
+		return false;
+
+	std::vector<int> traj;
+	for (int i=0; i<size; i++) {
+		int t;
+		in_file >> t;
+		if (in_file.fail() || t<0) return false;
+		traj.push_back(t);
+	}
+
+	in_file.close();
+
+	nbcidvar = cidvar;
+	nbtuning += tuning;
+	trajectory.insert(trajectory.begin(), traj.begin(), traj.end());
+
+	// skip the current tuning phase (if any)
+	if (nbcalls % (factor*nbinitcalls) < nbinitcalls)
+		nbcalls += nbinitcalls - nbcalls % (factor*nbinitcalls);
+
+	return true;
+}
+
 } // end namespace ibex
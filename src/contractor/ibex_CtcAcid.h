@@ -14,6 +14,9 @@
 #include "ibex_Ctc3BCid.h"
 #include "ibex_System.h"
 
+#include <vector>
+#include <stdint.h>
+
 namespace ibex {
 
 /**
@@ -82,6 +85,43 @@ public :
 
 	double nbvar_stat();
 
+	/**
+	 * \brief Save the tuning statistics.
+	 *
+	 * Write in a text file the statistics learned so far by the tuning phases:
+	 * <ul>
+	 * <li> the structural hash of the system (see #structural_hash(const System&)),
+	 * <li> the current number of variables to be shaved (nbcidvar) and the number of tuning phases,
+	 * <li> the value of nbcidvar computed at the end of each tuning phase (trajectory).
+	 * </ul>
+	 * \see #load_tuning(const char*).
+	 */
+	void save_tuning(const char* filename) const;
+
+	/**
+	 * \brief Warm-start with saved tuning statistics.
+	 *
+	 * If the statistics (see #save_tuning(const char*)) have been saved for a system with
+	 * the same structure, the number of variables to be shaved is set to the saved value.
+	 * The first tuning phase is then skipped: the next calls to #contract(IntervalVector&)
+	 * directly run with this value until the next (periodic) tuning phase.
+	 *
+	 * \return false if the file cannot be read, is not a tuning file or if the system
+	 *         does not match (nothing is loaded in these cases).
+	 */
+	bool load_tuning(const char* filename);
+
+	/**
+	 * \brief Structural hash of a system.
+	 *
+	 * Depends on the number of variables, the constraint operators and the structure
+	 * of the expressions (operators, dimensions, indices and exponents) but not on the
+	 * values of the constants nor on the names of the symbols. Two instances of
+	 * the same model with different parameters have the same hash. The hash does not
+	 * depend on the compiler nor on the platform.
+	 */
+	static uint32_t structural_hash(const System& sys);
+
 	/** the handled constraint system */
 	const System& system;
 
@@ -106,6 +146,9 @@ protected :
 	int nbcidvar;
 	int nbtuning;
 	bool optim;
+
+	/** Value of nbcidvar computed at the end of each tuning phase. */
+	std::vector<int> trajectory;
 };
 
 } // end namespace ibex
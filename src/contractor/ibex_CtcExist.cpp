@@ -10,6 +10,10 @@
 #include "ibex_CtcExist.h"
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -70,41 +74,77 @@ CtcExist::CtcExist(const NumConstraint& c, const Array<const ExprSymbol>& y, con
 	CtcQuantif(c, y, y_init, prec) {
 }
 
-void CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y) {
-	IntervalVector x = x_current;
+CtcExist::pair_status CtcExist::proceed(const IntervalVector& x_res, IntervalVector& x, IntervalVector& y, IntervalVector& x_sample, int t) {
+
+	x_sample.set_empty();
 
 	try {
-		CtcQuantif::contract(x, y);
+		CtcQuantif::contract(x, y, t);
 	} catch (EmptyBoxException&) {
-		return;
+		return INFEASIBLE;
 	}
 
-	if (!x.is_subset(x_res)) {
+	if (x.is_subset(x_res)) return LEAF;
 
-		if (y.max_diam()<=prec) {
-			x_res |= x;
-			if (x_res==x_init) return;
-		}
-		else {
-
-			l.push(pair<IntervalVector,IntervalVector>(x,y));
-
-			// ============================== sampling =============================
-			// To converge faster to the result, we contract with the mid-vector of y.
-			// This allows to get an estimate of "res" without waiting for epsilon-sized
-			// parameter boxes (getting quickly some estimate is important for pruning).
-			try {
-				IntervalVector y_mid = y.mid();
-				CtcQuantif::contract(x,y_mid);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
-				x_res |= x;
-				if (x_res==x_init) return;
-			} catch (EmptyBoxException&) {
-				// do nothing
+	if (y.max_diam()<=prec) {
+		x_sample=x;
+		return LEAF;
+	}
+
+	// ============================== sampling =============================
+	// To converge faster to the result, we contract with the mid-vector of y.
+	// This allows to get an estimate of "res" without waiting for epsilon-sized
+	// parameter boxes (getting quickly some estimate is important for pruning).
+	try {
+		IntervalVector y_mid = y.mid();
+		x_sample=x;
+		CtcQuantif::contract(x_sample,y_mid,t);  // x is not contracted here (it is pushed on the stack).
+	} catch (EmptyBoxException&) {
+		x_sample.set_empty();
+	}
+	// =======================================================================
+
+	return SPLIT;
+}
+
+void CtcExist::proceed(vector<pair<IntervalVector,IntervalVector> >& pairs, const IntervalVector& x_init, IntervalVector& x_res, IntervalVector& y_res, int nb_threads) {
+	int n=pairs.size();
+
+	IntervalVector x_sample(Ctc::nb_var);
+
+	if (nb_threads==1) {
+		for (int i=0; i<n; i++) {
+			if (x_res==x_init) {
+				// nothing more to find (the remaining pairs are kept as they are)
+				y_res |= pairs[i].second;
+				continue;
 			}
-			// =======================================================================
+			pair_status status=proceed(x_res, pairs[i].first, pairs[i].second, x_sample, 0);
+			if (!x_sample.is_empty()) x_res |= x_sample;
+			if (status==SPLIT) l.push(pairs[i]);
+			else if (status==LEAF) y_res |= pairs[i].second;
 		}
+		return;
+	}
+
+	vector<char> status(n);
+	vector<IntervalVector> samples(n, x_sample);
+
+	// note: x_res is only read by the threads
+#pragma omp parallel for schedule(dynamic)
+	for (int i=0; i<n; i++) {
+		int t=0;
+#ifdef _OPENMP
+		t=omp_get_thread_num();
+#endif
+		status[i]=proceed(x_res, pairs[i].first, pairs[i].second, samples[i], t);
 	}
 
+	for (int i=0; i<n; i++) {
+		if (!samples[i].is_empty()) x_res |= samples[i];
+		if (status[i]==SPLIT) l.push(pairs[i]);
+		else if (status[i]==LEAF) y_res |= pairs[i].second;
+	}
 }
 
 void CtcExist::contract(IntervalVector& box) {
@@ -115,31 +155,51 @@ void CtcExist::contract(IntervalVector& box) {
 
 	assert(l.empty()); // even when an exception is thrown by this function, l is empty.
 
-	l.push(pair<IntervalVector,IntervalVector>(box, y_init));
-	
-	IntervalVector x_save(Ctc::nb_var);
-	IntervalVector x(Ctc::nb_var);
+	int nb_threads=CtcQuantif::nb_threads();
+
+	// the pairs to be proceeded (the subboxes of the pairs on top of the stack)
+	vector<pair<IntervalVector,IntervalVector> > pairs;
 
-	IntervalVector y(nb_param);
-	IntervalVector y_mid(nb_param); // for sampling
+	// the hull of the boxes of parameters not proven infeasible
+	IntervalVector y_res=IntervalVector::empty(nb_param);
 
-	while (!l.empty()) {
+	const vector<IntervalVector>* start = memo? memo_find(box) : NULL;
 
-		// get the domain of variables
-		x_save = l.top().first;
+	if (!start)
+		l.push(pair<IntervalVector,IntervalVector>(box, y_init));
+	else if ((*start)[0].max_diam()>prec)
+		l.push(pair<IntervalVector,IntervalVector>(box, (*start)[0]));
+	else
+		pairs.push_back(pair<IntervalVector,IntervalVector>(box, (*start)[0]));
+
+	while (!l.empty() || !pairs.empty()) {
 		// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
-		pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top().second);
-		
-		l.pop();
+		while (!l.empty() && (int) pairs.size()<2*nb_threads) {
+			pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top().second);
+			pairs.push_back(pair<IntervalVector,IntervalVector>(l.top().first, cut.first));
+			pairs.push_back(pair<IntervalVector,IntervalVector>(l.top().first, cut.second));
+			l.pop();
+		}
+
+		proceed(pairs, box, res, y_res, nb_threads);
+		pairs.clear();
 
-		// proceed with the two sub-boxes for y
-		proceed(box, x_save, res, cut.first);
-		proceed(box, x_save, res, cut.second);
+		if (res==box) {
+			// the box cannot be contracted anymore
+			while (!l.empty()) {
+				y_res |= l.top().second;
+				l.pop();
+			}
+		}
 	}
 
 	box &= res;
 	if (box.is_empty()) throw EmptyBoxException();
 
+	if (memo) {
+		vector<IntervalVector> y(1, y_res);
+		memo_record(box, y);
+	}
 }
 
 
@@ -14,6 +14,7 @@
 
 #include <stack>
 #include <list>
+#include <vector>
 
 namespace ibex {
 
@@ -136,17 +137,33 @@ public:
 
 private:
 	/**
-	 * Function call by contract to proceed a pair (x,y).
+	 * Status of a pair (x,y) after #proceed(...)
+	 */
+	typedef enum { INFEASIBLE, LEAF, SPLIT } pair_status;
+
+	/**
+	 * Function called by contract to proceed a pair (x,y).
+	 *
+	 * \param x_res:    the current state of the overall result (proj-union). Corresponds, at the end, to the result
+	 *                  of the contraction
+	 * \param x:        the current box "x" generated by the branch & bound inside the contract(...) function (contracted)
+	 * \param y:        the current box "y" (contracted)
+	 * \param x_sample: set to the box to be added to x_res (possibly empty)
+	 * \param t:        the thread number
 	 *
-	 * The overall result x_res is updated, as well as y, and a new pair (x',y') is possibly pushed in the list "l".
+	 * \return INFEASIBLE if the pair is infeasible, SPLIT if (x,y) must be bisected
+	 *         and LEAF otherwise.
+	 */
+	pair_status proceed(const IntervalVector& x_res, IntervalVector& x, IntervalVector& y, IntervalVector& x_sample, int t);
+
+	/**
+	 * Proceed all the pairs in "pairs" (concurrently if nb_threads>1), update the
+	 * result x_res, push the pairs to be bisected in the list "l" and add the boxes "y"
+	 * of the other feasible pairs to y_res.
 	 *
-	 * \param x_init:    the initial box "x" to be contracted
-	 * \param x_current: the current box "x" generated by the branch & bound inside the contract(...) function
-	 * \param x_res:     the current state of the overall result (proj-union). Corresponds, at the end, to the result
-	 *                   of the contraction
-	 * \param y:         the current box "y"
+	 * x_init is the initial box "x" to be contracted.
 	 */
-	void proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y);
+	void proceed(std::vector<std::pair<IntervalVector,IntervalVector> >& pairs, const IntervalVector& x_init, IntervalVector& x_res, IntervalVector& y_res, int nb_threads);
 
 	/**
 	 * Stack of pairs (x,y)
@@ -10,6 +10,10 @@
 #include "ibex_CtcForAll.h"
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -70,18 +74,63 @@ CtcForAll::CtcForAll(const NumConstraint& c, const Array<const ExprSymbol>& y, c
 	CtcQuantif(c, y, y_init, prec) {
 }
 
-void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y) {
-
-	try {
-		IntervalVector y_mid = y.mid();
-		CtcQuantif::contract(x, y_mid);
-	} catch (EmptyBoxException& e) {
-		while (!l.empty()) l.pop();
-		throw e;
+CtcForAll::box_status CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, int t) {
+
+	IntervalVector y_mid = y.mid();
+	CtcQuantif::contract(x, y_mid, t);
+
+	// all the values of y in this box are satisfied by x
+	if (memo && inactive(x, y, t)) return INACTIVE;
+
+	return y.max_diam()>prec? SPLIT : LEAF;
+}
+
+void CtcForAll::proceed(IntervalVector& x, vector<IntervalVector>& ys, vector<IntervalVector>& leaves, int nb_threads) {
+	int n=ys.size();
+
+	vector<char> status(n);
+
+	if (nb_threads==1) {
+		for (int i=0; i<n; i++) {
+			try {
+				status[i]=proceed(x, ys[i], 0);
+			} catch (EmptyBoxException& e) {
+				while (!l.empty()) l.pop();
+				throw e;
+			}
+		}
+	} else {
+		vector<IntervalVector> boxes(n, x);
+		vector<char> empty(n);
+
+#pragma omp parallel for schedule(dynamic)
+		for (int i=0; i<n; i++) {
+			int t=0;
+#ifdef _OPENMP
+			t=omp_get_thread_num();
+#endif
+			empty[i]=0;
+			try {
+				status[i]=proceed(boxes[i], ys[i], t);
+			} catch (EmptyBoxException&) {
+				empty[i]=1;
+			}
+		}
+
+		for (int i=0; i<n && !x.is_empty(); i++) {
+			if (empty[i]) x.set_empty();
+			else x &= boxes[i];
+		}
+
+		if (x.is_empty()) {
+			while (!l.empty()) l.pop();
+			throw EmptyBoxException();
+		}
 	}
 
-	if (y.max_diam()>prec) {
-		l.push(y);
+	for (int i=0; i<n; i++) {
+		if (status[i]==SPLIT) l.push(ys[i]);
+		else if (status[i]==LEAF && memo) leaves.push_back(ys[i]);
 	}
 }
 
@@ -90,20 +139,36 @@ void CtcForAll::contract(IntervalVector& box) {
 
 	assert(l.empty()); // when an exception is thrown by this function, l is flushed.
 
-	l.push(y_init);
+	int nb_threads=CtcQuantif::nb_threads();
+
+	// the boxes to be proceeded (the subboxes of the boxes on top of the stack)
+	vector<IntervalVector> ys;
 
-	while (!l.empty()) {
+	// the boxes of parameters not proven inactive (memo mode)
+	vector<IntervalVector> leaves;
 
+	const vector<IntervalVector>* start = memo? memo_find(box) : NULL;
+
+	if (start)
+		ys = *start;
+	else
+		l.push(y_init);
+
+	do {
 		// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
-		pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top());
+		while (!l.empty() && (int) ys.size()<2*nb_threads) {
+			pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top());
+			ys.push_back(cut.first);
+			ys.push_back(cut.second);
+			l.pop();
+		}
 
-		l.pop();
+		proceed(box, ys, leaves, nb_threads);
+		ys.clear();
 
-		// proceed with the two sub-boxes for y
-		proceed(box, cut.first);
-		proceed(box, cut.second);
-	}
+	} while (!l.empty());
 
+	if (memo) memo_record(box, leaves);
 }
 
 
@@ -13,6 +13,7 @@
 #include "ibex_CtcQuantif.h"
 
 #include <stack>
+#include <vector>
 
 namespace ibex {
 
@@ -135,14 +136,28 @@ public:
 
 private:
 	/**
-	 * Function call by contract to proceed a pair (x,y).
-	 *
-	 * The overall result x is updated and, if large enough, y is pushed in the list "l".
+	 * Status of a box "y" after #proceed(...)
+	 */
+	typedef enum { INACTIVE, LEAF, SPLIT } box_status;
+
+	/**
+	 * Function called by contract to proceed a pair (x,y).
 	 *
-	 * \param x:   the current box "x". Corresponds, at the end, to the result of the contraction
+	 * \param x:   the current box "x", contracted with the mid-vector of y.
 	 * \param y:   the current box "y"
+	 * \param t:   the thread number
+	 *
+	 * \return INACTIVE if (x,y) is proven inactive (memo mode only), SPLIT if y must be
+	 *         bisected and LEAF otherwise.
+	 */
+	box_status proceed(IntervalVector& x, const IntervalVector& y, int t);
+
+	/**
+	 * Proceed all the boxes in "ys" (concurrently if nb_threads>1), contract x, push the
+	 * boxes to be bisected in the list "l" and add the other boxes not proven inactive
+	 * to "leaves" (memo mode).
 	 */
-	void proceed(IntervalVector& x, const IntervalVector& y);
+	void proceed(IntervalVector& x, std::vector<IntervalVector>& ys, std::vector<IntervalVector>& leaves, int nb_threads);
 
 	/**
 	 * Stack of y
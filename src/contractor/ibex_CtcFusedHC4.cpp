@@ -0,0 +1,285 @@
+/* ============================================================================
+ * I B E X - HC4 on the whole system with a shared DAG
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CtcFusedHC4.h"
+#include "ibex_ExprShare.h"
+#include "ibex_ExprCopy.h"
+
+#include <vector>
+
+namespace ibex {
+
+namespace {
+
+int image_size(const System& sys) {
+	int m=0;
+	for (int j=0; j<sys.ctrs.size(); j++)
+		m += sys.ctrs[j].f.image_dim();
+	return m;
+}
+
+/*
+ * The nodes that are direct arguments of a node.
+ */
+class ExprArgs : public virtual ExprVisitor {
+public:
+	std::vector<const ExprNode*> args;
+
+	void visit(const ExprNode& e)     { e.acceptVisitor(*this); }
+	void visit(const ExprIndex& i)    { args.push_back(&i.expr); }
+	void visit(const ExprLeaf& )      { }
+	void visit(const ExprNAryOp& e)   { for (int i=0; i<e.nb_args; i++) args.push_back(&e.arg(i)); }
+	void visit(const ExprBinaryOp& b) { args.push_back(&b.left); args.push_back(&b.right); }
+	void visit(const ExprUnaryOp& u)  { args.push_back(&u.expr); }
+};
+
+Interval right_cst(CmpOp op) {
+	switch (op) {
+	case LT :
+	case LEQ : return Interval::NEG_REALS;
+	case EQ  : return Interval::ZERO;
+	default  : return Interval::POS_REALS;
+	}
+}
+
+} // end anonymous namespace
+
+CtcFusedHC4::CtcFusedHC4(const System& sys, double ratio) : Ctc(sys.nb_var),
+		d(image_size(sys)>1? Dim::col_vec(image_size(sys)) : Dim::scalar()), ratio(ratio), nb_evals(0) {
+
+	assert(sys.nb_ctr>0);
+
+	int m=image_size(sys);
+
+	Array<const ExprSymbol> x(sys.args.size());
+	varcopy(sys.args, x);
+
+	Array<const ExprNode> image(m);
+	IntervalVector y(m);
+	int i=0;
+
+	// all the constraints are copied with the same
+	// "share" object so that common subexpressions are merged.
+	ExprShare share;
+
+	// concatenate all the components of all the constraints
+	// (see System::init_f_from_ctrs())
+	for (int j=0; j<sys.ctrs.size(); j++) {
+		Function& fj=sys.ctrs[j].f;
+		const ExprNode& e=share.copy(fj.args(), x, fj.expr());
+
+		const Dim& fjd=fj.expr().dim;
+		switch (fjd.type()) {
+		case Dim::SCALAR :
+			y[i]=right_cst(sys.ctrs[j].op);
+			image.set_ref(i++,e);
+			break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:
+			for (int k=0; k<fjd.vec_size(); k++) {
+				y[i]=right_cst(sys.ctrs[j].op);
+				image.set_ref(i++,e[k]);
+			}
+			break;
+		case Dim::MATRIX:
+			for (int k=0; k<fjd.dim2; k++)
+				for (int l=0; l<fjd.dim3; l++) {
+					y[i]=right_cst(sys.ctrs[j].op);
+					image.set_ref(i++,e[k][l]);
+				}
+			break;
+		default:
+			assert(false);
+			break;
+		}
+	}
+	assert(i==m);
+
+	if (m>1) {
+		f.init(x, ExprVector::new_(image,false));
+		d.v()=y;
+	} else {
+		f.init(x, image[0]);
+		d.i()=y[0];
+	}
+
+	// ============= structure of the DAG ====================
+	int n=f.nb_nodes();
+	NodeMap<int> rank;
+	for (int k=0; k<n; k++)
+		rank.insert(f.node(k),k);
+
+	var_first = new int[n];
+	var_last  = new int[n];
+	dom       = new Domain*[n];
+	dirty     = new bool[n];
+	touched   = new bool[n];
+	reduced   = new bool[nb_var];
+	old       = new Interval[n];
+
+	for (int k=0; k<n; k++) {
+		var_first[k]=var_last[k]=-1;
+		dom[k]=f.node(k).deco.d;
+	}
+
+	for (int k=0, first=0; k<f.nb_arg(); first+=f.arg(k).dim.size(), k++) {
+		// note: an argument that does not occur in the
+		// expression is not a node of the DAG
+		if (rank.found(f.arg(k))) {
+			var_first[rank[f.arg(k)]]=first;
+			var_last[rank[f.arg(k)]]=first+f.arg(k).dim.size()-1;
+		}
+	}
+
+	std::vector<int> index;
+	arg_start = new int[n+1];
+
+	for (int k=0; k<n; k++) {
+		arg_start[k]=index.size();
+		ExprArgs a;
+		a.visit(f.node(k));
+		for (std::vector<const ExprNode*>::iterator it=a.args.begin(); it!=a.args.end(); it++)
+			index.push_back(rank[**it]);
+	}
+	arg_start[n]=index.size();
+
+	arg_index = new int[index.size()];
+	for (unsigned int j=0; j<index.size(); j++)
+		arg_index[j]=index[j];
+
+	// the arguments of a node are after it (by decreasing height)
+	for (int k=n-1; k>=0; k--) {
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&f.node(k));
+		if (idx && var_first[arg_index[arg_start[k]]]!=-1) {
+			// indexed symbol: x[i] represents the ith
+			// block of the variables of x
+			int size=idx->dim.size();
+			var_first[k]=var_first[arg_index[arg_start[k]]]+idx->index*size;
+			var_last[k]=var_first[k]+size-1;
+		}
+	}
+
+	input = new BitSet(0,nb_var-1,BitSet::empt);
+	output = new BitSet(0,nb_var-1,BitSet::empt);
+
+	for (int k=0; k<f.nb_used_vars(); k++) {
+		input->add(f.used_var(k));
+		output->add(f.used_var(k));
+	}
+}
+
+CtcFusedHC4::~CtcFusedHC4() {
+	delete[] arg_start;
+	delete[] arg_index;
+	delete[] var_first;
+	delete[] var_last;
+	delete[] dom;
+	delete[] dirty;
+	delete[] touched;
+	delete[] reduced;
+	delete[] old;
+	delete input;
+	delete output;
+}
+
+void CtcFusedHC4::contract(IntervalVector& box) {
+
+	assert(box.size()==nb_var);
+
+	int n=f.nb_nodes();
+
+	// all the nodes are evaluated by the first sweep
+	for (int i=0; i<n; i++) dirty[i]=true;
+
+	IntervalVector old_box(box);
+	Domain& root=*dom[0];
+	bool first=true;
+
+	try {
+		f.write_arg_domains(box);
+
+		while (true) {
+			// ============== forward ==============
+			for (int i=n-1; i>=0; i--) {
+				if (!first) {
+					dirty[i]=false;
+					if (var_first[i]!=-1) {
+						for (int v=var_first[i]; v<=var_last[i] && !dirty[i]; v++)
+							dirty[i]=reduced[v];
+					} else {
+						for (int j=arg_start[i]; j<arg_start[i+1] && !dirty[i]; j++)
+							dirty[i]=dirty[arg_index[j]];
+					}
+				}
+				if (dirty[i]) {
+					f.forward(eval,i);
+					nb_evals++;
+				}
+			}
+
+			bool inactive=d.dim.is_scalar()? root.i().is_subset(d.i()) : root.v().is_subset(d.v());
+
+			// note: the intersection also detects an empty component
+			root &= d;
+
+			if (root.is_empty()) throw EmptyBoxException();
+
+			if (inactive) {
+				set_flag(INACTIVE);
+				set_flag(FIXPOINT);
+				return;
+			}
+
+			// ============== backward ==============
+			touched[0]=true;
+			for (int i=1; i<n; i++) touched[i]=false;
+
+			for (int i=0; i<n; i++) {
+				if (!dirty[i] && !touched[i]) continue;
+
+				int* a=&arg_index[arg_start[i]];
+				int nb_args=arg_start[i+1]-arg_start[i];
+
+				for (int j=0; j<nb_args; j++)
+					if (dom[a[j]]->dim.is_scalar()) old[j]=dom[a[j]]->i();
+
+				f.backward(hc4r,i);
+
+				// only the arguments actually contracted are propagated
+				for (int j=0; j<nb_args; j++)
+					if (!dom[a[j]]->dim.is_scalar() || old[j]!=dom[a[j]]->i())
+						touched[a[j]]=true;
+			}
+
+			f.read_arg_domains(box);
+
+			bool stop=true;
+			for (int k=0; k<f.nb_used_vars(); k++) {
+				int v=f.used_var(k);
+				reduced[v]=old_box[v].ratiodelta(box[v])>=ratio;
+				if (reduced[v]) {
+					stop=false;
+					old_box[v]=box[v];
+				}
+			}
+
+			if (stop) break;
+
+			first=false;
+		}
+
+	} catch (EmptyBoxException& e) {
+		box.set_empty();
+		throw e;
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,104 @@
+/* ============================================================================
+ * I B E X - HC4 on the whole system with a shared DAG
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CTC_FUSED_HC4_H__
+#define __IBEX_CTC_FUSED_HC4_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_CtcPropag.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_Eval.h"
+#include "ibex_System.h"
+
+namespace ibex {
+
+/** \ingroup contractor
+ *
+ * \brief HC4 with all the constraints fused in a single DAG.
+ *
+ * All the constraints of the system are merged into one vector-valued
+ * function where identical subexpressions of different constraints are
+ * represented by a single node (see #ibex::ExprShare).
+ *
+ * The contraction is a sequence of sweeps. Each sweep is a forward evaluation of the
+ * DAG followed by a backward propagation where the projections coming from
+ * different constraints are intersected at the shared nodes. The first sweep
+ * involves the whole DAG. The next ones only evaluate again the nodes that depend on a
+ * variable reduced by the previous sweep; the other nodes keep the domain resulting
+ * from the previous backward propagation. In the same way, the backward propagation
+ * only goes through these nodes and the nodes that have been contracted.
+ *
+ * Sweeps stop when no domain is reduced by more than #ratio (same criterion
+ * as #ibex::CtcPropag) or when all the constraints are inactive.
+ *
+ * Compared to #ibex::CtcHC4, a shared subexpression is evaluated once per sweep
+ * instead of once per constraint (see also #nb_evals).
+ */
+class CtcFusedHC4 : public Ctc {
+public:
+	/**
+	 * \brief Create the fused HC4 of a system.
+	 *
+	 * \param sys - The system (must contain at least one constraint)
+	 * \param ratio (optional) - \see #ibex::CtcPropag
+	 */
+	CtcFusedHC4(const System& sys, double ratio=CtcPropag::default_ratio);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CtcFusedHC4();
+
+	/**
+	 * \brief Contract the box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/** The fused function (one component per constraint component). */
+	Function f;
+
+	/** The domain "y" such that the system is "f(x) in y". */
+	Domain d;
+
+	/** Propagation ratio. */
+	const double ratio;
+
+	/** Number of node evaluations (forward) performed so far (statistic). */
+	long nb_evals;
+
+protected:
+	/*
+	 * Structure of the DAG. The nodes are numbered as in Function::node(int).
+	 * The arguments of the ith node are arg_index[arg_start[i]],...,arg_index[arg_start[i+1]-1].
+	 */
+	int* arg_start;
+	int* arg_index;
+
+	/* The variables represented by a symbol or an indexed symbol are var_first[i],...,var_last[i]
+	 * (var_first[i]==-1 for the other nodes). */
+	int* var_first;
+	int* var_last;
+
+	/* Domain of each node. */
+	Domain** dom;
+
+	/* Working data of #contract(IntervalVector&) */
+	bool* dirty;       // nodes to be evaluated again by the current sweep
+	bool* touched;     // nodes to be propagated backward
+	bool* reduced;     // variables reduced by the last sweep (by more than the ratio)
+	Interval* old;     // domains of the arguments of a node before projection
+
+	Eval eval;
+	HC4Revise hc4r;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CTC_FUSED_HC4_H__
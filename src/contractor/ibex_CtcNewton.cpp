@@ -14,9 +14,11 @@
 namespace ibex {
 
 const double CtcNewton::default_ceil = 0.01;
+const double CtcNewton::default_reuse_ratio = 0.5;
 
 CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio),
+		reuse(false), reuse_ratio(default_reuse_ratio), mid_rad(false), nb_reuse(0) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -25,8 +27,49 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 
 void CtcNewton::contract(IntervalVector& box) {
 	if (!(box.max_diam()<=ceil)) return;
-	else newton(f,box,prec,gauss_seidel_ratio);
+	else if (reuse) contract_reuse(box);
+	else newton(f,box,prec,gauss_seidel_ratio,mid_rad);
 
 }
 
+void CtcNewton::contract_reuse(IntervalVector& box) {
+
+	// look for the preconditioner of the smallest box enclosing the current one
+	while (!cache.empty() && !box.is_subset(cache.back().box))
+		cache.pop_back();
+
+	bool update;
+
+	if (!cache.empty()) {
+		Precond& p=cache.back();
+		IntervalVector init(box);
+		update=false;
+		newton(f,p.C,update,box,prec,gauss_seidel_ratio,mid_rad);
+
+		if (init.rel_distance(box) >= reuse_ratio*p.gain) {
+			nb_reuse++;
+			return;
+		}
+		// otherwise: not effective anymore
+	}
+
+	Precond p(box);
+	update=true;
+	newton(f,p.C,update,box,prec,gauss_seidel_ratio,mid_rad);
+
+	if (update) return; // no preconditioner computed
+
+	p.gain=p.box.rel_distance(box);
+
+	// a preconditioner that does not contract is useless
+	if (p.gain==0) return;
+
+	if (!cache.empty() && cache.back().box==p.box)
+		// same box (e.g., repeated calls): the new preconditioner replaces the previous one
+		cache.back()=p;
+	else if (cache.empty() || p.gain>cache.back().gain)
+		cache.push_back(p);
+	// otherwise: not better than the preconditioner of the enclosing box (kept)
+}
+
 } // end namespace ibex
@@ -13,12 +13,17 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_Newton.h"
+#include "ibex_Matrix.h"
+
+#include <vector>
 
 namespace ibex {
 
 /** \ingroup contractor
  * \brief Newton contractor.
  *
+ * Sparse Jacobian matrices are automatically handled by the
+ * sparse linear routines (see #ibex::default_sparse_jacobian_ratio).
  **/
 class CtcNewton : public Ctc {
 public:
@@ -47,9 +52,66 @@ public:
 	/** Gauss-Seidel ratio. See #ibex::newton(const Function&, IntervalVector&, double, double);*/
 	const double gauss_seidel_ratio;
 
+	/**
+	 * \brief Reuse the preconditioner (false by default).
+	 *
+	 * When set, the preconditioner (inverse of the midpoint of the Jacobian matrix) computed for
+	 * a box is kept and reused for the next boxes included in this box, typically the descendants
+	 * of this box in a search tree (siblings included). The preconditioner is reused as long as it
+	 * remains effective, i.e., as long as the contraction obtained with it is at least #reuse_ratio times
+	 * the contraction obtained when it was computed (contractions are measured by the relative distance
+	 * between the boxes before and after Newton). Otherwise, a new preconditioner is computed.
+	 *
+	 * In this mode, the same preconditioner is used for all the steps of the Newton iteration
+	 * (see #ibex::newton(const Fnc&, Matrix&, bool&, IntervalVector&, double, double)) and the dense
+	 * linear routines are used, even for sparse Jacobian matrices.
+	 */
+	bool reuse;
+
+	/** Reuse ratio (see #reuse). */
+	double reuse_ratio;
+
+	/**
+	 * \brief Precondition with midpoint-radius products (false by default).
+	 *
+	 * See #ibex::newton(const Fnc&, IntervalVector&, double, double, bool).
+	 */
+	bool mid_rad;
+
+	/** Number of calls where a previous preconditioner has been reused (statistic). */
+	long nb_reuse;
+
 	/** Initialized to 0.01 */
 	static const double default_ceil;
 
+	/** Initialized to 0.5 */
+	static const double default_reuse_ratio;
+
+protected:
+	/**
+	 * Newton with reuse of the preconditioner.
+	 */
+	void contract_reuse(IntervalVector& box);
+
+	/*
+	 * A preconditioner C computed for a box. The gain is the
+	 * relative distance between the box before and after the
+	 * Newton contraction that has computed C.
+	 */
+	struct Precond {
+		Precond(const IntervalVector& box) : box(box), C(box.size(),box.size()), gain(0) { }
+		IntervalVector box;
+		Matrix C;
+		double gain;
+	};
+
+	/*
+	 * The preconditioners of the "ancestors" of the current box, i.e., a
+	 * stack of preconditioners computed for decreasing (nested) boxes.
+	 * A preconditioner is only stacked if it improves the gain of the
+	 * top one (it replaces the top one if it is computed for the same box).
+	 */
+	std::vector<Precond> cache;
 };
 
 } // end namespace ibex
@@ -9,9 +9,11 @@
 
 #include "ibex_CtcPixelMap.h"
 
+#include <algorithm>
+
 namespace ibex {
 
-CtcPixelMap::CtcPixelMap(PixelMap &data): Ctc(data.ndim), I(data) {
+CtcPixelMap::CtcPixelMap(PixelMap &data): Ctc(data.ndim), parallel(false), I(data) {
     pixel_coords = new int[2*I.ndim];
 }
 
@@ -22,24 +24,21 @@ CtcPixelMap::~CtcPixelMap() {
 
 
 //-------------------------------------------------------------------------------------------------------------
-void CtcPixelMap::world_to_grid(IntervalVector box) {
+void CtcPixelMap::world_to_grid(const IntervalVector& box, int* coords) const {
 
-    for(unsigned int i = 0; i < box.size(); i++) {
-        box[i] = (box[i] - I.origin_[i]) / I.leaf_size_[i];
-        // Limit range to image size on pixel_coord
-        box[i] &= Interval(0,I.grid_size_[i]);
-    }
-    
     for (unsigned int i = 0; i < I.ndim; i++) {
-        pixel_coords[2*i]   = floor(box[i].lb());
-        pixel_coords[2*i+1] = ceil(box[i].ub()-1);
+        Interval x = (box[i] - I.origin_[i]) / I.leaf_size_[i];
+        // Limit range to image size on pixel_coord
+        x &= Interval(0,I.grid_size_[i]);
+        coords[2*i]   = floor(x.lb());
+        coords[2*i+1] = ceil(x.ub()-1);
     }
 }
 
 //-------------------------------------------------------------------------------------------------------------
-void CtcPixelMap::grid_to_world(IntervalVector& box) {
+void CtcPixelMap::grid_to_world(IntervalVector& box, const int* coords) const {
     for(unsigned int i = 0; i < I.ndim; i++) {
-        box[i] &= Interval(pixel_coords[2*i], pixel_coords[2*i+1]+1) * I.leaf_size_[i] + I.origin_[i];
+        box[i] &= Interval(coords[2*i], coords[2*i+1]+1) * I.leaf_size_[i] + I.origin_[i];
         if(box[i].is_empty()){
             box.set_empty();
             return;
@@ -54,14 +53,11 @@ void CtcPixelMap::contract(IntervalVector& box) {
     if(box.is_empty()) return;
 
     // Convert world coordinates into pixel coordinates
-    world_to_grid(box);
+    world_to_grid(box, pixel_coords);
 
     // Contractor the box
-    if( I.ndim == 2) {
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3]);
-    } else if ( I.ndim == 3){
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3],pixel_coords[4],pixel_coords[5]);        
-    }
+    contract(pixel_coords);
+
     // Check the result
     if(pixel_coords[0] == -1) {
         box.set_empty();
@@ -69,124 +65,193 @@ void CtcPixelMap::contract(IntervalVector& box) {
     }
 
     // Convert pixel coordinates into world coordinates
-    grid_to_world(box);
+    grid_to_world(box, pixel_coords);
 }
 
-//------------------------------------------------------------------------------
-//psi contraction
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin, int& cymax) {
+//----------------------------------------------------------------------------------------------------------------
+void CtcPixelMap::contract(std::vector<IntervalVector>& boxes) {
 
-    //compute enclosed pixels on consecutive lines from all dimensions of the box
+    const int n = boxes.size();
+    const int nc = 2*I.ndim;
 
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
+    // pixel coordinates of all the boxes
+    std::vector<int> coords(nc*n);
 
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax) == 0){
-        cxmin = -1;
-        return;
-    }
+    // tile of the lower corner of each box (-1 for an empty box)
+    std::vector<int> tile(n);
 
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax)>0) {
-            cxmin = i;
-            break;
-        }
-    }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax)>0) {
-            cxmax = i;
-            break;
+    size_t nb_tiles = 1;
+    for (unsigned int i = 0; i < I.ndim; i++)
+        nb_tiles *= I.data.nb_tiles[i];
+
+    // number of boxes per tile
+    std::vector<int> first(nb_tiles+1, 0);
+
+    for (int b = 0; b < n; b++) {
+        assert(boxes[b].size() == I.ndim);
+        if (boxes[b].is_empty()) {
+            tile[b] = -1;
+            continue;
         }
+
+        int* c = &coords[nc*b];
+        world_to_grid(boxes[b], c);
+
+        // (limited to the image)
+        int corner[3] = { 0, 0, 0 };
+        for (unsigned int i = 0; i < I.ndim; i++)
+            corner[i] = std::min(I.grid_size_[i]-1,std::max(0,c[2*i]));
+
+        tile[b] = I.data.tile(corner[0],corner[1],corner[2]);
+        first[tile[b]+1]++;
     }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j)>0) {
-            cymin = j;
-            break;
-        }
+
+    // sort the boxes by tile (counting sort)
+    for (size_t t = 0; t < nb_tiles; t++)
+        first[t+1] += first[t];
+
+    const int m = first[nb_tiles];
+    std::vector<int> order(m);
+
+    for (int b = 0; b < n; b++)
+        if (tile[b] != -1) order[first[tile[b]]++] = b;
+
+    // note: the boxes themselves are only read/written
+    // in their original order (before and after)
+#pragma omp parallel for schedule(dynamic,64) if(parallel)
+    for (int l = 0; l < m; l++) {
+        contract(&coords[nc*order[l]]);
     }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        if(enclosed_pixels(cxmin,cxmax,j,cymax)>0) {
-            cymax = j;
-            break;
-        }
+
+#pragma omp parallel for schedule(static) if(parallel)
+    for (int b = 0; b < n; b++) {
+        const int* c = &coords[nc*b];
+
+        if (tile[b] == -1) continue;
+
+        if (c[0] == -1)
+            boxes[b].set_empty();
+        else
+            grid_to_world(boxes[b], c);
     }
 }
-//////////////////////////////////////////////////////////////////////
 
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin,int& cymax, int& czmin, int& czmax) {
+//------------------------------------------------------------------------------
+//psi contraction
+void CtcPixelMap::contract(int* c) {
 
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
-    czmax = std::max(0, std::min(I.grid_size_[2]-1,czmax));
-    czmin = std::min(I.grid_size_[2]-1, std::max(0,czmin));
-    
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,czmax) == 0) {
-        cxmin = -1;
+    //compute enclosed pixels on consecutive lines from all dimensions of the box
+
+    for (unsigned int i = 0; i < I.ndim; i++) {
+        c[2*i+1] = std::max(0,std::min(I.grid_size_[i]-1,c[2*i+1]));
+        c[2*i]   = std::min(I.grid_size_[i]-1,std::max(0,c[2*i]));
+    }
+
+    if (enclosed_pixels(c) == 0){
+        c[0] = -1;
         return;
     }
 
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax,czmin,czmax)>0) {
-            cxmin = i;
-            break;
-        }
+    // right/left, down/up, bottom/top
+    for (unsigned int i = 0; i < I.ndim; i++) {
+        c[2*i]   = first_occupied(c,i);
+        c[2*i+1] = last_occupied(c,i);
     }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax,czmin,czmax)>0) {
-            cxmax = i;
+}
+
+//------------------------------------------------------------------------------
+int CtcPixelMap::first_occupied(const int* c, int d) {
+    // number of pixels below the box in the dth dimension
+    unsigned int s0 = slice_sum(c,d,c[2*d]-1);
+
+    int lo = c[2*d];
+    int hi = c[2*d+1];
+
+    // the result is in [lo,hi]. Look for an occupied box
+    // with an upper bound at distance 1,2,4,... from lo
+    for (int step = 1; lo + step - 1 < hi; step *= 2) {
+        int v = lo + step - 1;
+        if (slice_sum(c,d,v) != s0) {
+            hi = v;
             break;
         }
+        lo = v + 1;
     }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j,czmin,czmax)>0) {
-            cymin = j;
-            break;
-        }
+
+    // dichotomy
+    while (lo < hi) {
+        int v = lo + (hi-lo)/2;
+        if (slice_sum(c,d,v) != s0)
+            hi = v;
+        else
+            lo = v + 1;
     }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,j,cymax,czmin,czmax);
-        if(res>0) {
-            cymax = j;
+
+    return lo;
+}
+
+//------------------------------------------------------------------------------
+int CtcPixelMap::last_occupied(const int* c, int d) {
+    // number of pixels below the upper bound of the box in the dth dimension
+    unsigned int s1 = slice_sum(c,d,c[2*d+1]);
+
+    int lo = c[2*d];
+    int hi = c[2*d+1];
+
+    // the result is in [lo,hi]. Look for an occupied box
+    // with a lower bound at distance 1,2,4,... from hi
+    for (int step = 1; hi - step + 1 > lo; step *= 2) {
+        int v = hi - step + 1;
+        if (slice_sum(c,d,v-1) != s1) {
+            lo = v;
             break;
         }
+        hi = v - 1;
     }
-    //bottom
-    for (int k = czmin; k <=czmax; k++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,k)>0) {
-            czmin = k;
-            break;
-        }
+
+    // dichotomy
+    while (lo < hi) {
+        int v = hi - (hi-lo)/2;
+        if (slice_sum(c,d,v-1) != s1)
+            lo = v;
+        else
+            hi = v - 1;
     }
-    //top
-    for (int k = czmax; k >= czmin ; k--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,cymin,cymax,k,czmax);
-        if(res>0) {
-            czmax = k;
-            break;
+
+    return hi;
+}
+
+//------------------------------------------------------------------------------
+unsigned int CtcPixelMap::slice_sum(const int* c, int d, int v) {
+    unsigned int sum = 0;
+
+    // sum over the corners of the box in the other dimensions
+    for (int k = 0; k < (1<<(I.ndim-1)); k++) {
+        int p[3];
+        bool minus = false;
+        int bit = 0;
+        for (int i = 0; i < (int) I.ndim; i++) {
+            if (i == d)
+                p[i] = v;
+            else if (k & (1<<bit++)) {
+                p[i] = c[2*i]-1;
+                minus = !minus;
+            } else
+                p[i] = c[2*i+1];
         }
+
+        unsigned int L = I.ndim == 2 ? ((PixelMap2D&) I)(p[0],p[1]) : ((PixelMap3D&) I)(p[0],p[1],p[2]);
+        if (minus) sum -= L; else sum += L;
     }
+    return sum;
+}
+
+//------------------------------------------------------------------------------
+unsigned int CtcPixelMap::enclosed_pixels(const int* c) {
+    if (I.ndim == 2)
+        return enclosed_pixels(c[0],c[1],c[2],c[3]);
+    else
+        return enclosed_pixels(c[0],c[1],c[2],c[3],c[4],c[5]);
 }
 
 unsigned int CtcPixelMap::enclosed_pixels(int xmin,int xmax,int ymin,int ymax) {
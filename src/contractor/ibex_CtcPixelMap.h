@@ -11,6 +11,7 @@
 #define __IBEX_CTC_PIXEL_MAP_H__
 
 #include <iostream>
+#include <vector>
 #include "ibex_Ctc.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_PixelMap.h"
@@ -51,6 +52,26 @@ public:
      */
     void contract(IntervalVector& box);
 
+    /**
+     * \brief Contract a set of boxes
+     *
+     * Same result as #contract(IntervalVector&) applied to each box, but the
+     * boxes are processed by order of the tile of the map (see #ibex::PixelTiles)
+     * containing their lower corner, so that boxes in the same region of the map
+     * are contracted one after the other. If #parallel is true, the boxes are
+     * contracted by several threads (requires Ibex to be compiled with OpenMP,
+     * see option --with-openmp).
+     *
+     * \param boxes - boxes to be contracted
+     */
+    void contract(std::vector<IntervalVector>& boxes);
+
+    /**
+     * \brief Parallel mode for #contract(std::vector<IntervalVector>&)
+     *
+     * False by default.
+     */
+    bool parallel;
 
 private:
 
@@ -73,26 +94,56 @@ private:
      * \brief Converts coordinates from world frame to the image frame.
      *
      * \param box         - IntervalVector of coordinates in the world frame
+     * \param coords      - pixel coordinates (same layout as #pixel_coords)
      */
-    void world_to_grid(IntervalVector box);
+    void world_to_grid(const IntervalVector& box, int* coords) const;
 
     /**
      * \brief Converts coordinates of pixels into world frame coordinates.
      *
      * \param box         - IntervalVector of coordinates in the world frame
+     * \param coords      - pixel coordinates (same layout as #pixel_coords)
      */
-    void grid_to_world(IntervalVector& box);
+    void grid_to_world(IntervalVector& box, const int* coords) const;
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax] w.r.t the integral image.
+     * \brief contract the box of pixels defined by coords w.r.t the integral image.
+     *
+     * The first coordinate is set to -1 if the box contains no 1-valued pixel.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax);
+    void contract(int* coords);
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax]x[zmin, zmax] w.r.t the integral image.
+     * \brief Smallest value v of the dth coordinate such that the box of pixels
+     * coords with upper bound v in the dth dimension contains 1-valued pixels.
+     *
+     * The box coords must contain 1-valued pixels. The number of pixels being
+     * monotonic in v, a galloping search is performed from the lower bound.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax, int &czmin, int &czmax);
-    
+    int first_occupied(const int* coords, int d);
+
+    /**
+     * \brief Greatest value v of the dth coordinate such that the box of pixels
+     * coords with lower bound v in the dth dimension contains 1-valued pixels.
+     *
+     * Same as #first_occupied(const int*,int), from the upper bound.
+     */
+    int last_occupied(const int* coords, int d);
+
+    /**
+     * \brief Return the number of 1-valued pixels in the box of pixels coords
+     * where the dth coordinate is replaced by [0,v] (modulo 2^32).
+     *
+     * The number of pixels in the box with the dth coordinate in [a,b] is
+     * slice_sum(coords,d,b)-slice_sum(coords,d,a-1).
+     */
+    unsigned int slice_sum(const int* coords, int d, int v);
+
+    /**
+     * \brief Return the number of 1-valued pixels in the box of pixels coords.
+     */
+    unsigned int enclosed_pixels(const int* coords);
+
     /**
      * \brief Return the number of 1-valued pixels in the box [xmin,xmax] x [ymin, ymax].
      *
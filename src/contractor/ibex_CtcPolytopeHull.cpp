@@ -11,13 +11,20 @@
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxFixed.h"
 
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
 
 CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter, int time_out, double eps, Interval limit_diam) :
 		Ctc(lr.nb_var()), lr(lr), goal_var(lr.goal_var()), cmode(cmode),
-		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(false) {
+		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), parallel(false), own_lr(false),
+		max_iter(max_iter), time_out(time_out), eps(eps) {
 
 	 mylinearsolver = new LinearSolver(nb_var, lr.nb_ctr(), max_iter, time_out, eps);
 
@@ -25,7 +32,8 @@ CtcPolytopeHull::CtcPolytopeHull(LinearRelax& lr, ctc_mode cmode, int max_iter,
 
 CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter, int time_out, double eps, Interval limit_diam) :
 		Ctc(A.nb_cols()), lr(*new LinearRelaxFixed(A,b)), goal_var(lr.goal_var()), cmode(ALL_BOX),
-		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), own_lr(true) {
+		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()), parallel(false), own_lr(true),
+		max_iter(max_iter), time_out(time_out), eps(eps) {
 
 	 mylinearsolver = new LinearSolver(nb_var, lr.nb_ctr(), max_iter, time_out, eps);
 
@@ -33,17 +41,23 @@ CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter,
 
 CtcPolytopeHull::~CtcPolytopeHull() {
 	if (mylinearsolver!=NULL) delete mylinearsolver;
+	for (int i=0; i<lp_copies.size(); i++)
+		delete &lp_copies[i];
 	if (own_lr) delete &lr;
 }
 
-#ifndef  _IBEX_WITH_NOLP_
-
 void CtcPolytopeHull::contract(IntervalVector& box) {
 
 	if (!(limit_diam_box.contains(box.max_diam()))) return;
+
 	// is it necessary?  YES (BNE) Soplex can give false infeasible results with large numbers
 	//cout << "[polytope-hull] box before LR (linear relaxation): " << box << endl;
 
+	int nb_threads=1;
+#ifdef _OPENMP
+	if (parallel) nb_threads=omp_get_max_threads();
+#endif
+
 	try {
 		// Update the bounds the variables
 		mylinearsolver->initBoundVar(box);
@@ -53,7 +67,10 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 		//cout << "[polytope-hull] end of LR" << endl;
 		if(cont<1)  return;
 
-		optimizer(box);
+		if (nb_threads>1)
+			parallel_optimizer(box, nb_threads);
+		else
+			optimizer(box);
 
 		//mylinearsolver->writeFile("LP.lp");
 		//system ("cat LP.lp");
@@ -68,12 +85,7 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 
 }
 
-void CtcPolytopeHull::optimizer(IntervalVector& box) {
-
-	Interval opt(0.0);
-	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
-	int* sup_bound = new int[nb_var]; // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
-
+void CtcPolytopeHull::init_indicators(int* inf_bound, int* sup_bound) {
 	if (cmode==ONLY_Y) {
 		for (int i=0; i<nb_var; i++) {
 			// in the case of lower_bounding, only the left bound of y is contracted
@@ -90,6 +102,15 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		if (goal_var>-1) sup_bound[goal_var]=1;
 	}
+}
+
+void CtcPolytopeHull::optimizer(IntervalVector& box) {
+
+	Interval opt(0.0);
+	int* inf_bound = new int[nb_var]; // indicator inf_bound = 1 means the inf bound is feasible or already contracted, call to simplex useless (cf Baharev)
+	int* sup_bound = new int[nb_var]; // indicator sup_bound = 1 means the sup bound is feasible or already contracted, call to simplex useless
+
+	init_indicators(inf_bound, sup_bound);
 
 	int nexti=-1;   // the next variable to be contracted
 	int infnexti=0; // the bound to be contracted contract  infnexti=0 for the lower bound, infnexti=1 for the upper bound
@@ -104,7 +125,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		if (infnexti==0 && inf_bound[i]==0)  // computing the left bound : minimizing x_i
 		{
 			inf_bound[i]=1;
-			stat = run_simplex(box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
+			stat = run_simplex(*mylinearsolver, box, LinearSolver::MINIMIZE, i, opt,box[i].lb());
 			//cout << "[polytope-hull]->[optimize] simplex for left bound returns stat:" << stat <<  " opt: " << opt << endl;
 			if (stat == LinearSolver::OPTIMAL) {
 				if(opt.lb()>box[i].ub()) {
@@ -118,7 +139,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 					mylinearsolver->setBoundVar(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (!choose_next_variable(*mylinearsolver, box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
@@ -152,7 +173,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 		}
 		else if (infnexti==1 && sup_bound[i]==0) { // computing the right bound :  maximizing x_i
 			sup_bound[i]=1;
-			stat= run_simplex(box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
+			stat= run_simplex(*mylinearsolver, box, LinearSolver::MAXIMIZE, i, opt, box[i].ub());
 			//cout << "[polytope-hull]->[optimize] simplex for right bound returns stat=" << stat << " opt=" << opt << endl;
 			if( stat == LinearSolver::OPTIMAL) {
 				if(opt.ub() <box[i].lb()) {
@@ -166,7 +187,7 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 					mylinearsolver->setBoundVar(i,box[i]);
 				}
 
-				if (!choose_next_variable(box,nexti,infnexti, inf_bound, sup_bound)) {
+				if (!choose_next_variable(*mylinearsolver, box,nexti,infnexti, inf_bound, sup_bound)) {
 					break;
 				}
 			}
@@ -204,26 +225,138 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 
 }
 
-LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, LinearSolver::Sense sense, int var, Interval& obj, double bound) {
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box, int nb_threads) {
+
+	// one linear solver per thread (the first one is mylinearsolver)
+	if (lp_copies.size()<nb_threads-1) {
+		int n=lp_copies.size();
+		lp_copies.resize(nb_threads-1);
+		for (int k=n; k<nb_threads-1; k++)
+			lp_copies.set_ref(k, *new LinearSolver(nb_var, lr.nb_ctr(), max_iter, time_out, eps));
+	}
+	for (int k=0; k<nb_threads-1; k++)
+		copy_constraints(lp_copies[k]);
+
+	int* inf_bound = new int[nb_var];
+	int* sup_bound = new int[nb_var];
+	init_indicators(inf_bound, sup_bound);
+
+	// the bounds to be computed: 2i for the left bound of the ith variable, 2i+1 for the right one
+	vector<int> bounds;
+	for (int i=0; i<nb_var; i++) {
+		if (inf_bound[i]==0) bounds.push_back(2*i);
+		if (sup_bound[i]==0) bounds.push_back(2*i+1);
+	}
+	int n=bounds.size();
+
+	// box with which each thread calls the simplex
+	vector<IntervalVector> boxes(nb_threads, box);
+
+	bool empty=false; // the infeasibility is proved
+	bool stop=false;  // no other call is needed
+
+#pragma omp parallel for schedule(dynamic) num_threads(nb_threads)
+	for (int k=0; k<n; k++) {
+		int t=0;
+#ifdef _OPENMP
+		t=omp_get_thread_num();
+#endif
+		LinearSolver& lp = t==0? *mylinearsolver : lp_copies[t-1];
+		IntervalVector& x = boxes[t];
+		int i=bounds[k]/2;
+		bool left=bounds[k]%2==0;
+		bool skip;
+
+#pragma omp critical(ibex_polytope_hull)
+		{
+			int& done=left? inf_bound[i] : sup_bound[i];
+			skip = empty || stop || done==1;
+			done=1;
+			// the last contracted box
+			if (!skip) x=box;
+		}
+
+		if (skip) continue;
+
+		Interval opt(0.0);
+		LinearSolver::Status_Sol stat=LinearSolver::UNKNOWN;
+
+		try {
+			lp.initBoundVar(x);
+			if (left)
+				stat = run_simplex(lp, x, LinearSolver::MINIMIZE, i, opt, x[i].lb());
+			else
+				stat = run_simplex(lp, x, LinearSolver::MAXIMIZE, i, opt, x[i].ub());
+		} catch (LPException&) { }
+
+#pragma omp critical(ibex_polytope_hull)
+		{
+			if (stat == LinearSolver::OPTIMAL) {
+				if (left) {
+					if (opt.lb()>box[i].ub()) empty=true;
+					else if (opt.lb()>box[i].lb()) box[i]=Interval(opt.lb(),box[i].ub());
+				} else {
+					if (opt.ub()<box[i].lb()) empty=true;
+					else if (opt.ub()<box[i].ub()) box[i]=Interval(box[i].lb(),opt.ub());
+				}
+				// mark the bounds reached by the primal solution
+				int nexti, infnexti;
+				if (!empty) choose_next_variable(lp, box, nexti, infnexti, inf_bound, sup_bound);
+			}
+			else if (stat == LinearSolver::INFEASIBLE)
+				empty=true;
+			else if (stat != LinearSolver::UNKNOWN)
+				// INFEASIBLE_NOTPROVED, MAX_ITER or TIME_OUT: same as the sequential mode
+				stop=true;
+		}
+	}
+
+	delete[] inf_bound;
+	delete[] sup_bound;
+
+	if (empty) throw EmptyBoxException();
+}
+
+void CtcPolytopeHull::copy_constraints(LinearSolver& lp) {
+	lp.cleanConst();
+
+	int first=lp.getNbRows(); // the rows of the bounds of the variables
+	int nr=mylinearsolver->getNbRows();
+
+	Matrix A(nr,nb_var);
+	mylinearsolver->getCoefConstraint(A);
+	IntervalVector B(nr);
+	mylinearsolver->getB(B);
+
+	for (int i=first; i<nr; i++) {
+		Vector row=A.row(i);
+		if (B[i].lb()>-LinearSolver::default_max_bound)
+			lp.addConstraint(row, GEQ, B[i].lb());
+		if (B[i].ub()<LinearSolver::default_max_bound)
+			lp.addConstraint(row, LEQ, B[i].ub());
+	}
+}
+
+LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(LinearSolver& lp, IntervalVector& box, LinearSolver::Sense sense, int var, Interval& obj, double bound) {
 
 	int nvar=nb_var;
-	int nctr=mylinearsolver->getNbRows();
+	int nctr=lp.getNbRows();
 	// the linear solver is always called in a minimization mode : in case of maximization of var , the opposite of var is minimized
 	if(sense==LinearSolver::MINIMIZE)
-		mylinearsolver->setVarObj(var, 1.0);
+		lp.setVarObj(var, 1.0);
 	else
-		mylinearsolver->setVarObj(var, -1.0);
+		lp.setVarObj(var, -1.0);
 
 	LinearSolver::Status_Sol stat = LinearSolver::UNKNOWN;
 	try {
-		//	mylinearsolver->writeFile("coucou.lp");
+		//	lp.writeFile("coucou.lp");
 		//	system("cat coucou.lp");
-		stat = mylinearsolver->solve();
+		stat = lp.solve();
 		//cout << "[polytope-hull]->[run_simplex] solver returns " << stat << endl;
 
 		if(stat == LinearSolver::OPTIMAL) {
-			if( ((sense==LinearSolver::MINIMIZE) && (  mylinearsolver->getObjValue() <=bound)) ||
-					((sense==LinearSolver::MAXIMIZE) && ((-mylinearsolver->getObjValue())>=bound))) {
+			if( ((sense==LinearSolver::MINIMIZE) && (  lp.getObjValue() <=bound)) ||
+					((sense==LinearSolver::MAXIMIZE) && ((-lp.getObjValue())>=bound))) {
 				stat = LinearSolver::UNKNOWN;
 			}
 		}
@@ -232,41 +365,41 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, Linea
 		if(stat == LinearSolver::OPTIMAL) {
 
 			// the dual solution : used to compute the bound
-			Vector dual_solution(mylinearsolver->getNbRows());
-			mylinearsolver->getDualSol(dual_solution);
+			Vector dual_solution(lp.getNbRows());
+			lp.getDualSol(dual_solution);
 
-			Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-			mylinearsolver->getCoefConstraint_trans(A_trans);
+			Matrix A_trans (nb_var,lp.getNbRows()) ;
+			lp.getCoefConstraint_trans(A_trans);
 
-			/*	IntervalMatrix IA_trans (nb_var,mylinearsolver->getNbRows());
+			/*	IntervalMatrix IA_trans (nb_var,lp.getNbRows());
 			for (int i=0;i<nvar; i++){
 			  for(int j=0; j<nctr; j++)
 				IA_trans[i][j]= A_trans[i][j];
 			}*/
-			IntervalVector B(mylinearsolver->getNbRows());
-			mylinearsolver->getB(B);
+			IntervalVector B(lp.getNbRows());
+			lp.getB(B);
 
 			bool minimization=false;
 			if (sense==LinearSolver::MINIMIZE)	minimization=true;
 
 			//	  cout << "B " << B << endl;
 			//	  cout << "A_trans " << IA_trans << endl;
-			NeumaierShcherbina_postprocessing( mylinearsolver->getNbRows(), var, obj, box, A_trans, B, dual_solution, minimization);
+			NeumaierShcherbina_postprocessing( lp.getNbRows(), var, obj, box, A_trans, B, dual_solution, minimization);
 		}
 
 		// infeasibility test  cf Neumaier Shcherbina paper
 		if(stat == LinearSolver::INFEASIBLE_NOTPROVED) {
 
-			Vector infeasible_dir(mylinearsolver->getNbRows());
-			mylinearsolver->getInfeasibleDir(infeasible_dir);
+			Vector infeasible_dir(lp.getNbRows());
+			lp.getInfeasibleDir(infeasible_dir);
 
-			Matrix A_trans (nb_var,mylinearsolver->getNbRows()) ;
-			mylinearsolver->getCoefConstraint_trans(A_trans);
+			Matrix A_trans (nb_var,lp.getNbRows()) ;
+			lp.getCoefConstraint_trans(A_trans);
 
-			IntervalVector B(mylinearsolver->getNbRows());
-			mylinearsolver->getB(B);
+			IntervalVector B(lp.getNbRows());
+			lp.getB(B);
 
-			if (NeumaierShcherbina_infeasibilitytest (mylinearsolver->getNbRows(), box, A_trans, B, infeasible_dir)) {
+			if (NeumaierShcherbina_infeasibilitytest (lp.getNbRows(), box, A_trans, B, infeasible_dir)) {
 				stat = LinearSolver::INFEASIBLE;
 			}
 		}
@@ -275,7 +408,7 @@ LinearSolver::Status_Sol CtcPolytopeHull::run_simplex(IntervalVector& box, Linea
 		stat = LinearSolver::UNKNOWN;
 	}
 	// Reset the objective of the LP solver
-	mylinearsolver->setVarObj(var, 0.0);
+	lp.setVarObj(var, 0.0);
 
 	return stat;
 
@@ -331,21 +464,21 @@ bool CtcPolytopeHull::NeumaierShcherbina_infeasibilitytest(int nr, IntervalVecto
 
 }
 
-bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
+bool CtcPolytopeHull::choose_next_variable(LinearSolver& lp, IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
 
 	bool found = false;
 
 	try {
 		// the primal solution : used by choose_next_variable
 		Vector primal_solution(nb_var);
-		mylinearsolver->getPrimalSol(primal_solution);
+		lp.getPrimalSol(primal_solution);
 		//cout << " primal " << primal_solution << endl;
 
 		// The Achterberg heuristic for choosing the next variable (nexti) and its bound (infnexti) to be contracted (cf Baharev paper)
 		// and updating the indicators if a bound has been found feasible (with the precision prec_bound)
 		// called only when a primal solution is found by the LP solver (use of primal_solution)
 
-		// double prec_bound = mylinearsolver->getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
+		// double prec_bound = lp.getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
 		double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
 		double delta=1.e100;
 		double deltaj=delta;
@@ -396,15 +529,4 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 
 }
 
-#else /// end _IBEX_WITH_NOLP_
-
-
-void CtcPolytopeHull::contract(IntervalVector& box) { }
-
-
-#endif /// end _IBEX_WITH_NOLP_
-
-
-
-
 } // end namespace ibex
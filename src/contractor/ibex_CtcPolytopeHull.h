@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_LinearRelax.h"
 #include "ibex_LinearSolver.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -22,6 +23,12 @@ namespace ibex {
  *
  * The polytope is obtained by linearizing a system.
  * \see #LinearRelax.
+ *
+ * The same linear program is used for all the bounds and all the boxes.
+ * With SoPlex (and the built-in simplex), from one box to the next, only the
+ * bounds of the variables and the coefficients of the linear constraints are
+ * updated. The linear solver can then start from the optimal basis found for
+ * the previous bound (warm start).
  */
 class CtcPolytopeHull : public Ctc {
 public:
@@ -66,9 +73,26 @@ public:
 
 	virtual ~CtcPolytopeHull();
 
+	/**
+	 * \brief Parallel mode (false by default).
+	 *
+	 * The bounds of the variables are computed concurrently, each thread
+	 * solving its own copy of the linear program (the constraints are built once by
+	 * the linear relaxation and copied). Each bound certified by the Neumaier-Shcherbina
+	 * postprocessing is immediately intersected with the box, and the next linear
+	 * programs are solved with the bounds of the contracted box.
+	 * A bound reached by the primal solution of a linear program is not computed.
+	 *
+	 * Since the bounds are not computed in the same order, the result may slightly
+	 * differ from the sequential mode.
+	 *
+	 * This mode is only effective if Ibex is compiled with OpenMP (option --with-openmp)
+	 * and more than one thread is available.
+	 */
+	bool parallel;
+
 protected:
 
-#ifndef _IBEX_WITH_NOLP_
 	/**
 	 * Neumaier Shcherbina postprocessing in case of optimal solution found : the result obj is made reliable
 	 */
@@ -82,20 +106,35 @@ protected:
 	/**
 	 * Achterberg heuristic for choosing the next variable  and which bound to optimize
 	 */
-	bool choose_next_variable(IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
+	bool choose_next_variable(LinearSolver& lp, IntervalVector &box,  int & nexti, int & infnexti, int* inf_bound, int* sup_bound);
 
 	/**
 	 * Call to linear solver
 	 */
-	LinearSolver::Status_Sol run_simplex(IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
+	LinearSolver::Status_Sol run_simplex(LinearSolver& lp, IntervalVector &box, LinearSolver::Sense sense, int var, Interval & obj, double bound);
+
+	/**
+	 * Set inf_bound[i] (resp. sup_bound[i]) to 1 if the left (resp. right) bound of
+	 * the ith variable must not be contracted.
+	 */
+	void init_indicators(int* inf_bound, int* sup_bound);
 
 	/**
 	 * TODO: add comment
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * Same as optimizer(...) but the bounds are computed in parallel (see #parallel).
+	 */
+	void parallel_optimizer(IntervalVector &box, int nb_threads);
+
+	/**
+	 * Replace the constraints of lp by the ones of #mylinearsolver
+	 * (the bounds of the variables are not copied).
+	 */
+	void copy_constraints(LinearSolver& lp);
 
-#endif /// end _IBEX_WITH_NOLP_
 
 	/**
 	 * \brief The linearization technique
@@ -125,8 +164,18 @@ protected:
 	 */
 	LinearSolver *mylinearsolver;
 
+	/**
+	 * \brief Copies of the linear solver (parallel mode).
+	 *
+	 * Built on the first parallel contraction, one per additional thread.
+	 */
+	Array<LinearSolver> lp_copies;
+
 private:
 	bool own_lr;
+	const int max_iter;
+	const int time_out;
+	const double eps;
 
 };
 
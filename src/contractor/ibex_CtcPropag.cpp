@@ -14,26 +14,74 @@
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Input (resp. output) variables of the contractors.
+ * Note: the output variables of a contractor are
+ * ignored if the input variables are unspecified.
+ */
+vector<const BitSet*> ctc_vars(const Array<Ctc>& cl, bool input) {
+	vector<const BitSet*> vars(cl.size());
+	for (int i=0; i<cl.size(); i++) {
+		vars[i] = !cl[i].input? NULL : (input? cl[i].input : cl[i].output);
+	}
+	return vars;
+}
+
+}
+
 /*! Default propagation ratio. */
 #define __IBEX_DEFAULT_RATIO_PROPAG           0.01
 
 
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  _impact(BitSet::empty(nb_var)), flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS)), active(BitSet::empty(cl.size())) {
+		  accumulate(false), priority(false), parallel(false), g(nb_var, ctc_vars(cl,true), ctc_vars(cl,false)), agenda(cl.size()),
+		  prio_agenda(cl.size()), _impacts(cl.size(), BitSet::empty(nb_var)), nb_calls(cl.size(),0), nb_success(cl.size(),0),
+		  global(cl.size()), flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS)), active(BitSet::empty(cl.size())) {
 
 	assert(check_nb_var_ctc_list(cl));
 
-	for (int i=0; i<list.size(); i++)
-		for (int j=0; j<nb_var; j++) {
-			if (list[i].input && (*list[i].input)[j]) g.add_arc(i,j,true);
-			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
+	// greedy coloring of the contractors: two contractors
+	// sharing a variable must have different colors.
+	vector<int> color(list.size());
+	vector<int> forbidden; // forbidden[k]==c <=> color k is used by a neighbor of c
+	for (int c=0; c<list.size(); c++) {
+		global[c]=(list[c].input==NULL);
+		if (global[c]) continue; // see below
+		DirectedHyperGraph::Range vars[2] = { g.input_vars(c), g.output_vars(c) };
+		for (int i=0; i<2; i++)
+			for (const int* v=vars[i].begin(); v!=vars[i].end(); v++) {
+				DirectedHyperGraph::Range ctrs[2] = { g.input_ctrs(*v), g.output_ctrs(*v) };
+				for (int j=0; j<2; j++)
+					for (const int* c2=ctrs[j].begin(); c2!=ctrs[j].end() && *c2<c; c2++)
+						forbidden[color[*c2]]=c;
+			}
+		int k=0;
+		while (k<(int) forbidden.size() && forbidden[k]==c) k++;
+		if (k==(int) forbidden.size()) {
+			forbidden.push_back(-1);
+			rounds.push_back(vector<int>());
 		}
+		color[c]=k;
+		rounds[k].push_back(c);
+	}
+
+	// a contractor with unspecified variables may read or write
+	// any variable: it is alone in its color.
+	for (int c=0; c<list.size(); c++) {
+		if (global[c])
+			rounds.push_back(vector<int>(1,c));
+	}
 
 	//cout << g << endl;
 }
@@ -43,23 +91,13 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 	assert(box.size()==nb_var);
 
-	/*
-	 * When we call a contractor, we assume all
-	 * its variables have been impacted although there might be
-	 * only one of them impacted. In a future version, we may
-	 * consider a more fine propagation where the information
-	 * about the variables that are actually impacted is
-	 * given to the awaken contractor.
-	 */
-	_impact.fill(0,nb_var-1);
-
 	// By default, all contractors are active
 	active.fill(0,list.size()-1);
 
 	if (incremental) {
 		/**
 		 * impact() is the impact in input (given to CtcPropag).
-		 * Not to be confused with _impact.
+		 * Not to be confused with _impacts.
 		 *
 		 * Note: when impact() is NULL, we can
 		 * also push all the contractors in a simple loop,
@@ -71,14 +109,18 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (!impact() || (*impact())[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(i);
+				for (const int* c=ctrs.begin(); c!=ctrs.end(); c++) {
+					_impacts[*c].add(i);
+					push(*c,0);
+				}
 			}
 		}
 	} else { // push all the contractors
-		for (int i=0; i<list.size(); i++)
-			agenda.push(i);
+		for (int i=0; i<list.size(); i++) {
+			_impacts[i].fill(0,nb_var-1);
+			push(i,0);
+		}
 	}
 
 	int c; // current contractor
@@ -90,22 +132,27 @@ void  CtcPropag::contract(IntervalVector& box) {
 	 */
 	IntervalVector old_box(box);
 
+	if (parallel) {
+		contract_rounds(box, old_box);
+		return;
+	}
+
 	//   VECTOR thres(_nb_var);        // threshold for propagation
 	//   for (int i=1; i<=_nb_var; i++) {
 	//     thres(i) = ratio*Diam(box(i));
 	//     if (thres(i)<w) thres(i)=w;
 	//   }
 	//cout << "=========== Start propagation ==========" << endl;
-	while (!agenda.empty()) {
+	while (!empty_agenda()) {
 
-		agenda.pop(c);
+		pop(c);
 
-		set<int> vars=g.output_vars(c);
+		DirectedHyperGraph::Range vars=g.output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
+			for (const int* v=vars.begin(); v!=vars.end(); v++) {
 				old_box[*v] = box[*v];
 			}
 		}
@@ -114,27 +161,40 @@ void  CtcPropag::contract(IntervalVector& box) {
 		//cout << "Contraction with " << c << endl;
 
 		try {
-			list[c].contract(box, _impact, flags);
+			list[c].contract(box, _impacts[c], flags);
 			if (flags[INACTIVE]) {
 				active.remove(c);
 			}
 		}
 		catch (EmptyBoxException& e) {
-			agenda.flush();
+			_impacts[c].clear();
+			while (!empty_agenda()) {
+				pop(c);
+				_impacts[c].clear();
+			}
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
 			throw e;
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
+		_impacts[c].clear();
+		nb_calls[c]++;
+
+		bool propagated=false;
+
+		for (const int* it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
-			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
+			double gain=old_box[v].ratiodelta(box[v]);
+			//cout << "   " << old_box[v] << " % " << box[v] << "   " << gain << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
-			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
-					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT]))
-						agenda.push(*c2);
+			if (gain>=ratio) {
+				propagated=true;
+				DirectedHyperGraph::Range ctrs=g.output_ctrs(v);
+				for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT])) {
+						_impacts[*c2].add(v);
+						push(*c2, gain);
+					}
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
@@ -144,6 +204,8 @@ void  CtcPropag::contract(IntervalVector& box) {
 			}
 		}
 
+		if (propagated) nb_success[c]++;
+
 		//cout << "  =>" << box << endl;
 		//cout << agenda << endl;
 
@@ -158,6 +220,157 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 }
 
+void CtcPropag::contract_rounds(IntervalVector& box, IntervalVector& old_box) {
+
+	BitSet pending(BitSet::empty(list.size()));
+	int nb_pending=0;
+
+	int c;
+	while (!empty_agenda()) {
+		pop(c);
+		pending.add(c);
+		nb_pending++;
+	}
+
+	int nb_threads=1;
+#ifdef _OPENMP
+	nb_threads=omp_get_max_threads();
+#endif
+
+	// private copies of the box and flags of each thread
+	vector<IntervalVector> boxes(nb_threads, box);
+	vector<BitSet> thread_flags(nb_threads, BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
+
+	// status of the contractors of the current round
+	vector<char> fixpoint(list.size());
+	vector<char> inactive(list.size());
+	vector<char> failed(list.size());
+	// reduced[v]: domain of v reduced by more than the ratio
+	// (the contractors of a round share no variable)
+	vector<char> reduced(nb_var,0);
+
+	// all the variables (those of a contractor with unspecified variables)
+	vector<int> all_vars(nb_var);
+	for (int v=0; v<nb_var; v++) all_vars[v]=v;
+
+	vector<int> round;
+	bool empty=false;
+
+	while (nb_pending>0 && !empty) {
+
+		for (unsigned int k=0; k<rounds.size(); k++) {
+
+			round.clear();
+			for (vector<int>::const_iterator it=rounds[k].begin(); it!=rounds[k].end(); it++) {
+				if (pending[*it]) {
+					pending.remove(*it);
+					nb_pending--;
+					round.push_back(*it);
+				}
+			}
+
+			int n=round.size();
+			if (n==0) continue;
+
+#pragma omp parallel for schedule(dynamic) if (n>1)
+			for (int i=0; i<n; i++) {
+				int t=0;
+#ifdef _OPENMP
+				t=omp_get_thread_num();
+#endif
+				int c=round[i];
+				IntervalVector& x=boxes[t];
+				const int* out_begin;
+				const int* out_end;
+
+				if (global[c]) {
+					// alone in its round: refresh (and merge) the whole box
+					x=box;
+					out_begin=&all_vars[0];
+					out_end=out_begin+nb_var;
+				} else {
+					DirectedHyperGraph::Range in=g.input_vars(c);
+					DirectedHyperGraph::Range out=g.output_vars(c);
+
+					for (const int* v=in.begin(); v!=in.end(); v++) x[*v]=box[*v];
+					for (const int* v=out.begin(); v!=out.end(); v++) x[*v]=box[*v];
+					out_begin=out.begin();
+					out_end=out.end();
+				}
+
+				thread_flags[t].clear();
+				failed[c]=0;
+				try {
+					list[c].contract(x, _impacts[c], thread_flags[t]);
+				} catch (EmptyBoxException&) {
+					failed[c]=1;
+				}
+				fixpoint[c]=thread_flags[t][FIXPOINT];
+				inactive[c]=thread_flags[t][INACTIVE];
+
+				if (!failed[c]) {
+					// merge (the variables of c are only
+					// read and written by c in this round).
+					for (const int* v=out_begin; v!=out_end; v++) {
+						Interval old=accumulate? old_box[*v] : box[*v];
+						box[*v] &= x[*v];
+						if (old.ratiodelta(box[*v])>=ratio)
+							reduced[*v]=1;
+					}
+				}
+			}
+
+			for (int i=0; i<n; i++)
+				if (failed[round[i]]) empty=true;
+
+			if (empty) break;
+
+			for (int i=0; i<n; i++) {
+				int c=round[i];
+				_impacts[c].clear();
+				nb_calls[c]++;
+				if (inactive[c]) active.remove(c);
+
+				bool propagated=false;
+
+				const int* vars_begin=g.output_vars(c).begin();
+				const int* vars_end=g.output_vars(c).end();
+				if (global[c]) {
+					vars_begin=&all_vars[0];
+					vars_end=vars_begin+nb_var;
+				}
+				for (const int* it=vars_begin; it!=vars_end; it++) {
+					int v=*it;
+					if (!reduced[v]) continue;
+					reduced[v]=0;
+					propagated=true;
+					DirectedHyperGraph::Range ctrs=g.output_ctrs(v);
+					for (const int* c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
+						if ((c!=*c2 && active[*c2]) || (c==*c2 && !fixpoint[c])) {
+							_impacts[*c2].add(v);
+							if (!pending[*c2]) {
+								pending.add(*c2);
+								nb_pending++;
+							}
+						}
+					}
+					if (accumulate)
+						old_box[v] = box[v];
+				}
+
+				if (propagated) nb_success[c]++;
+			}
+		}
+	}
+
+	if (empty) {
+		for (int i=0; i<list.size(); i++)
+			_impacts[i].clear();
+		box.set_empty();
+		throw EmptyBoxException();
+	}
+}
+
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
 
 } // namespace ibex
@@ -17,6 +17,8 @@
 #include "ibex_DirectedHyperGraph.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -27,6 +29,15 @@ namespace ibex {
  * This class is an implementation of the classical interval variant of the AC3 constraint propagation
  * algorithm.
  *
+ * By default, the agenda is a FIFO. If #priority is set, the agenda is ordered by the expected gain
+ * of the contractors: when the domain of a variable is reduced, the priority of every contractor
+ * depending on this variable is increased by the relative reduction of the domain
+ * (see Interval::ratiodelta) times the weight of the contractor.
+ * The weight of a contractor is its rate of success, i.e., the proportion of its calls that
+ * have triggered propagation.
+ *
+ * Each contractor is called with the exact set of variables that have been impacted since
+ * its last call (see Ctc::contract(IntervalVector&, const BitSet&, BitSet&)).
  */
 class CtcPropag : public Ctc {
 public:
@@ -71,6 +82,30 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/** Order the agenda by expected gain (false by default)? Otherwise, the agenda is a FIFO. */
+	bool priority;
+
+	/**
+	 * Parallel propagation (false by default).
+	 *
+	 * The contractors are colored so that two contractors of the same color share no
+	 * variable. The propagation then proceeds by rounds: a round calls all the pending
+	 * contractors of one color concurrently, each on a private copy of the box, and
+	 * intersects the results with the box. Propagation is stopped with the same #ratio
+	 * criterion as in the sequential mode.
+	 *
+	 * A contractor with unspecified input variables (Ctc::input is NULL) may use any
+	 * variable: it is alone in its round, contracts the whole box and its reductions
+	 * are propagated as if all the variables were output variables.
+	 *
+	 * The rounds are run by a pool of threads if Ibex is compiled with OpenMP
+	 * (option --with-openmp), sequentially otherwise.
+	 *
+	 * \warning The contractors must be thread-safe (e.g., the CtcFwdBwd
+	 *          contractors of CtcHC4 built from different constraints).
+	 */
+	bool parallel;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static const double default_ratio;
 
@@ -79,9 +114,40 @@ protected:
 
 	DirectedHyperGraph g; // constraint network (hypergraph)
 
-	Agenda agenda;        // propagation agenda
+	Agenda agenda;      // propagation agenda (FIFO)
+
+	PriorityAgenda prio_agenda; // propagation agenda (if #priority is set)
+
+	/**
+	 * Push a sub-contractor in the agenda. If #priority is set,
+	 * its expected gain is \a gain times its rate of success.
+	 */
+	void push(int c, double gain);
 
-	BitSet _impact;     // impact given to sub-contractors
+	/**
+	 * Pop a sub-contractor from the agenda.
+	 */
+	void pop(int& c);
+
+	/**
+	 * True iff the agenda is empty.
+	 */
+	bool empty_agenda() const;
+
+	std::vector<BitSet> _impacts;   // impact given to each sub-contractor
+
+	std::vector<int> nb_calls;      // number of calls of each sub-contractor
+
+	std::vector<int> nb_success;    // number of calls of each sub-contractor that have triggered propagation
+
+	std::vector<std::vector<int> > rounds; // contractors of each color (parallel mode)
+
+	std::vector<bool> global; // sub-contractors with unspecified variables (parallel mode)
+
+	/**
+	 * Propagation by rounds of contractors sharing no variable (parallel mode).
+	 */
+	void contract_rounds(IntervalVector& box, IntervalVector& old_box);
 
 	BitSet flags;       // status of a contraction
 
@@ -90,5 +156,24 @@ protected:
 
 };
 
+/*============================================ inline implementation ============================================ */
+
+inline void CtcPropag::push(int c, double gain) {
+	if (priority)
+		// expected gain: relative reduction times the rate of success
+		prio_agenda.push(c, gain*(1.0+nb_success[c])/(1.0+nb_calls[c]));
+	else
+		agenda.push(c);
+}
+
+inline void CtcPropag::pop(int& c) {
+	if (priority) prio_agenda.pop(c);
+	else agenda.pop(c);
+}
+
+inline bool CtcPropag::empty_agenda() const {
+	return priority? prio_agenda.empty() : agenda.empty();
+}
+
 } // namespace ibex
 #endif // __IBEX_CTC_PROPAG_H__
@@ -14,23 +14,51 @@
 
 namespace ibex {
 
-CtcQInter::CtcQInter(const Array<Ctc>& list, int q) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
+CtcQInter::CtcQInter(const Array<Ctc>& list, int q, qinter_algo algo, bool incremental) : Ctc(list), list(list), q(q), algo(algo),
+		incremental(incremental), nb_calls(0), boxes(list.size(), nb_var), refs(list.size()), last_input(list.size(), nb_var),
+		qboxes(nb_var, incremental? list.size() : 0) {
+
+	for (int i=0; i<list.size(); i++) {
+		refs.set_ref(i,boxes[i]);
+		last_input[i].set_empty();
+	}
+}
 
 
 void CtcQInter::contract(IntervalVector& box) {
-	Array<IntervalVector> refs(list.size());
 
 	for (int i=0; i<list.size(); i++) {
+		if (incremental && box.is_subset(last_input[i])) {
+			// the previous result is empty or included in the box: nothing to do
+			if (boxes[i].is_subset(box)) continue;
+			// the previous result is outside the box
+			if (!boxes[i].intersects(box)) {
+				// the empty set is now the result for this box only
+				last_input[i]=box;
+				boxes[i].set_empty();
+				qboxes.set(i,boxes[i]);
+				continue;
+			}
+		}
+
+		if (incremental) last_input[i]=box;
 		try {
 			boxes[i]=box;
+			nb_calls++;
 			list[i].contract(boxes[i]);
 		} catch(EmptyBoxException&) {
 			assert(boxes[i].is_empty());
 		}
-		refs.set_ref(i,boxes[i]);
+		if (incremental) qboxes.set(i,boxes[i]);
 	}
 
-	box = qinter(refs,q);
+	// note: without the incremental mode, all the boxes change at each call:
+	// the sorted bounds of qboxes are not maintained.
+	switch (algo) {
+	case QINTER_GRID  : box = qinter(refs,q); break;
+	case QINTER_SWEEP : box = incremental? qboxes.hull(q) : qinter2(refs,q); break;
+	default           : box = incremental? qboxes.projection(q) : qinter_projf(refs,q); break;
+	}
 
 	if (box.is_empty()) throw EmptyBoxException();
 }
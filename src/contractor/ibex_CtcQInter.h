@@ -14,6 +14,7 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_IncrQInter.h"
 
 namespace ibex {
 
@@ -24,12 +25,39 @@ namespace ibex {
  */
 class CtcQInter : public Ctc {
 public:
+	/**
+	 * \brief Q-intersection algorithm.
+	 *
+	 * <ul>
+	 * <li> QINTER_GRID:  exact, see #ibex::qinter(const Array<IntervalVector>&, int)
+	 * <li> QINTER_SWEEP: exact, see #ibex::qinter2(const Array<IntervalVector>&, int)
+	 * <li> QINTER_PROJ:  outer approximation, see #ibex::qinter_projf(const Array<IntervalVector>&, int)
+	 * </ul>
+	 * The two exact algorithms give the same result. The sweep algorithm is faster
+	 * with many boxes.
+	 */
+	typedef enum { QINTER_GRID, QINTER_SWEEP, QINTER_PROJ } qinter_algo;
+
 	/**
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
+	 *
+	 * \param incremental (optional) - If true, a contractor is only called again
+	 *                 if the box cuts the result of its previous call. More precisely,
+	 *                 if the box is included in the box given to the ith contractor
+	 *                 the last time, the result of this call is kept if it is included
+	 *                 in the box, and replaced by the empty set if it does not intersect
+	 *                 the box. The contractor is only called again if its previous result
+	 *                 is partially included in the box (or if the box is not included in
+	 *                 the last one). This is sound because the ith contractor is contracting
+	 *                 (the solutions in the box are in the previous result). This is
+	 *                 typically the case of most measurements from one node of a
+	 *                 branch & prune to its child, or from one iteration of a fixpoint to the next.
+	 *                 The result may however be less contracted than with a new
+	 *                 call of the contractor, if the latter is not idempotent. Default value is false.
 	 */
-	CtcQInter(const Array<Ctc>& list, int q);
+	CtcQInter(const Array<Ctc>& list, int q, qinter_algo algo=QINTER_SWEEP, bool incremental=false);
 
 	/**
 	 * \brief Contract the box.
@@ -47,8 +75,26 @@ public:
 	 */
 	int q;
 
+	/**
+	 * The q-intersection algorithm.
+	 */
+	qinter_algo algo;
+
+	/**
+	 * Incremental mode (see constructor).
+	 */
+	bool incremental;
+
+	/**
+	 * Number of calls to the contractors (statistic).
+	 */
+	long nb_calls;
+
 protected:
-	IntervalMatrix boxes; // store boxes for each contraction
+	IntervalMatrix boxes;       // store boxes for each contraction
+	Array<IntervalVector> refs; // references to the rows of "boxes"
+	IntervalMatrix last_input;  // box given to each contractor (incremental mode)
+	IncrQInter qboxes;          // q-intersection of the boxes (incremental mode)
 };
 
 } // end namespace ibex
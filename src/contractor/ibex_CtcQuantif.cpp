@@ -12,17 +12,23 @@
 
 #include <cassert>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
 namespace ibex {
 
 
 CtcQuantif::CtcQuantif(const NumConstraint& ctr, const Array<const ExprSymbol>& y, const IntervalVector& init_box, double prec)
- : Ctc(ctr.f.nb_arg()-y.size()), y_init(y.size())  {
+ : Ctc(ctr.f.nb_arg()-y.size()), y_init(y.size()), parallel(false), memo(false), _ctr(&ctr), _memo_y_init(init_box)  {
 	init(ctr, y, init_box, prec);
 }
 
 CtcQuantif::CtcQuantif(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box, double prec, bool own_ctc) :
-	Ctc(vars.size()), y_init(init_box), nb_param(init_box.size()), ctc(&ctc), bsc(new LargestFirst(prec)),
-	 vars(vars), prec(prec), _own_ctc(own_ctc) {
+	Ctc(vars.size()), y_init(init_box), parallel(false), memo(false), nb_param(init_box.size()), ctc(&ctc), bsc(new LargestFirst(prec)),
+	 vars(vars), prec(prec), _own_ctc(own_ctc), _ctr(NULL), _memo_y_init(init_box) {
 
 	assert(ctc.nb_var==(int)vars.size()+init_box.size());
 
@@ -31,6 +37,10 @@ CtcQuantif::CtcQuantif(Ctc& ctc, const BitSet& vars, const IntervalVector& init_
 CtcQuantif::~CtcQuantif(){
 	if (_own_ctc) delete ctc;
 	delete bsc;
+	for (int i=0; i<_ctc_copies.size(); i++) {
+		delete &_ctc_copies[i];
+		delete &_f_copies[i];
+	}
 }
 void CtcQuantif::init(const NumConstraint& ctr, const Array<const ExprSymbol>& y, const IntervalVector& init_box, double prec) {
 
@@ -64,7 +74,7 @@ void CtcQuantif::init(const NumConstraint& ctr, const Array<const ExprSymbol>& y
 }
 
 
-void CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
+void CtcQuantif::contract(IntervalVector& x, IntervalVector& y, int t) {
 	// create the full box by concatening x and y
 	int jx=0;
 	int jy=0;
@@ -74,7 +84,7 @@ void CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
 		if (vars[i]) fullbox[i]=x[jx++];
 		else         fullbox[i]=y[jy++];
 	}
-	ctc->contract(fullbox);
+	(t==0? *ctc : _ctc_copies[t-1]).contract(fullbox);
 
 	jx=jy=0;
 	for (int i=0; i<nb_var+nb_param; i++) {
@@ -83,4 +93,73 @@ void CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
 	}
 }
 
+bool CtcQuantif::inactive(const IntervalVector& x, const IntervalVector& y, int t) {
+	int jx=0;
+	int jy=0;
+	IntervalVector fullbox(nb_var+nb_param);
+
+	for (int i=0; i<nb_var+nb_param; i++) {
+		if (vars[i]) fullbox[i]=x[jx++];
+		else         fullbox[i]=y[jy++];
+	}
+
+	BitSet flags(BitSet::empty(Ctc::NB_OUTPUT_FLAGS));
+	try {
+		(t==0? *ctc : _ctc_copies[t-1]).contract(fullbox, BitSet::all(nb_var+nb_param), flags);
+	} catch (EmptyBoxException&) {
+		return false;
+	}
+	return flags[INACTIVE];
+}
+
+int CtcQuantif::nb_threads() {
+	int n=1;
+#ifdef _OPENMP
+	if (parallel && _ctr) n=omp_get_max_threads();
+#endif
+	// one copy of the constraint per thread (the first one is ctc)
+	if (_ctc_copies.size()<n-1) {
+		int k=_ctc_copies.size();
+		_f_copies.resize(n-1);
+		_ctc_copies.resize(n-1);
+		for (; k<n-1; k++) {
+			_f_copies.set_ref(k, *new Function(_ctr->f));
+			_ctc_copies.set_ref(k, *new CtcFwdBwd(_f_copies[k], _ctr->op));
+		}
+	}
+	return n;
+}
+
+const vector<IntervalVector>* CtcQuantif::memo_find(const IntervalVector& x) {
+	// the records are obsolete if y_init has changed
+	if (!(_memo_y_init==y_init)) {
+		_memo.clear();
+		_memo_y_init=y_init;
+	}
+
+	while (!_memo.empty() && !x.is_subset(_memo.back().first))
+		_memo.pop_back();
+
+	return _memo.empty()? NULL : &_memo.back().second;
+}
+
+void CtcQuantif::memo_record(const IntervalVector& x, vector<IntervalVector>& y) {
+	// note: the box on top of the stack contains x (see #memo_find)
+	if (!_memo.empty() && _memo.back().first==x) {
+		// same box (e.g., repeated calls): the new record replaces the previous one
+		_memo.back().second.swap(y);
+		y.clear();
+		return;
+	}
+
+	if (!_memo.empty() && _memo.back().second==y) {
+		// nothing more than the record of the enclosing box
+		y.clear();
+		return;
+	}
+
+	_memo.push_back(pair<IntervalVector, vector<IntervalVector> >(x, vector<IntervalVector>()));
+	_memo.back().second.swap(y);
+}
+
 } // namespace ibex
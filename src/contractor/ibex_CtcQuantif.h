@@ -16,6 +16,9 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_BitSet.h"
 
+#include <vector>
+#include <list>
+
 namespace ibex {
 
 /**
@@ -64,14 +67,80 @@ public:
 	 */
 	IntervalVector y_init;
 
+	/**
+	 * \brief Parallel exploration of the parameters (false by default).
+	 *
+	 * The boxes of parameters on top of the stack are bisected and the resulting
+	 * subboxes are processed concurrently, each on a private copy of the box
+	 * of variables. The results are then merged with the current result.
+	 *
+	 * The subboxes are processed by a pool of threads if Ibex is compiled with OpenMP
+	 * (option --with-openmp), sequentially otherwise. Each thread uses its own copy
+	 * of the constraint. For this reason, this flag is ignored if the contractor is built
+	 * from a contractor (instead of a constraint).
+	 */
+	bool parallel;
+
+	/**
+	 * \brief Memoization of the parameter search (false by default).
+	 *
+	 * The boxes of parameters remaining at the end of the search are recorded with the
+	 * resulting box of variables. When a subbox of the latter is contracted, the search
+	 * starts directly from these boxes of parameters instead of #y_init:
+	 * <ul>
+	 * <li> #ibex::CtcExist records the hull of the boxes not proven infeasible;
+	 * <li> #ibex::CtcForAll records the boxes not proven inactive (all the values of the
+	 *      parameters in an inactive box are satisfied by all the variables).
+	 * </ul>
+	 *
+	 * The recorded boxes form a stack (a box is included in the previous one)
+	 * that follows a depth-first search: when a box is contracted, the records of all
+	 * the boxes that do not contain it are discarded first. A record replaces the one
+	 * on top of the stack if the box is the same, and it is not stacked if the boxes of
+	 * parameters are the same.
+	 *
+	 * The contraction remains sound but may be weaker than without memoization
+	 * (the samples of the first levels of bisection are skipped).
+	 */
+	bool memo;
+
 protected:
 	/**
 	 * \brief Contract the "full" box (x,y)
 	 *
 	 * \param x the vector of variables
 	 * \param y the vector parameters.
+	 * \param t the thread number (see #parallel).
+	 */
+	void contract(IntervalVector& x, IntervalVector& y, int t=0);
+
+	/**
+	 * \brief True if the contractor proves that the box (x,y) is inactive.
+	 *
+	 * \param t the thread number (see #parallel).
 	 */
-	void contract(IntervalVector& x, IntervalVector& y);
+	bool inactive(const IntervalVector& x, const IntervalVector& y, int t=0);
+
+	/**
+	 * \brief Number of threads for the next contraction.
+	 *
+	 * Creates the copies of the constraint if necessary (see #parallel).
+	 */
+	int nb_threads();
+
+	/**
+	 * \brief Recorded boxes of parameters for x (see #memo).
+	 *
+	 * Return NULL if there is none.
+	 */
+	const std::vector<IntervalVector>* memo_find(const IntervalVector& x);
+
+	/**
+	 * \brief Record the boxes of parameters y for x (see #memo).
+	 *
+	 * The vector y is emptied.
+	 */
+	void memo_record(const IntervalVector& x, std::vector<IntervalVector>& y);
 
 	/**
 	 * \brief Number of parameters
@@ -107,6 +176,19 @@ private:
 
 	/* Information for cleanup only */
 	bool _own_ctc;
+
+	/* The constraint (NULL if the contractor is given) */
+	const NumConstraint* _ctr;
+
+	/* Copies of the constraint for the threads 1,2,... (see #parallel) */
+	Array<Function> _f_copies;
+	Array<Ctc> _ctc_copies;
+
+	/* Recorded boxes of variables and parameters (see #memo) */
+	std::list<std::pair<IntervalVector, std::vector<IntervalVector> > > _memo;
+
+	/* The value of y_init for the recorded boxes */
+	IntervalVector _memo_y_init;
 };
 
 } // namespace ibex
@@ -236,6 +236,63 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	}
 }
 
+SparseIntervalMatrix Function::jacobian_structure() const {
+	int m=image_dim();
+
+	int* row_start=new int[m+1];
+	row_start[0]=0;
+	for (int i=0; i<m; i++)
+		row_start[i+1]=row_start[i]+(*this)[i].nb_used_vars();
+
+	int* col_index=new int[row_start[m]];
+	for (int i=0; i<m; i++) {
+		const Function& fi=(*this)[i];
+		for (int l=0; l<fi.nb_used_vars(); l++)
+			col_index[row_start[i]+l]=fi.used_var(l);
+	}
+
+	Interval* val=new Interval[row_start[m]];
+	for (int k=0; k<row_start[m]; k++) val[k]=Interval::ZERO;
+
+	SparseIntervalMatrix J(m, nb_var(), row_start, col_index, val);
+
+	delete[] val;
+	delete[] col_index;
+	delete[] row_start;
+	return J;
+}
+
+void Function::hansen_matrix(const IntervalVector& box, SparseIntervalMatrix& H) const {
+	assert(H.nb_cols()==nb_var());
+	assert(box.size()==nb_var());
+	assert(H.nb_rows()==image_dim());
+
+	// see Fnc::hansen_matrix. The variables of the ith component
+	// are replaced one by one by their domain, in increasing order.
+	IntervalVector x=box.mid();
+	IntervalVector g(nb_var());
+	Gradient grad;
+
+	for (int i=0; i<image_dim(); i++) {
+		const Function& fi=(*this)[i];
+		assert(H.row_end(i)-H.row_begin(i)==fi.nb_used_vars());
+
+		int k=H.row_begin(i);
+		for (int l=0; l<fi.nb_used_vars(); l++, k++) {
+			int j=fi.used_var(l);
+			assert(H.index(k)==j);
+			x[j]=box[j];
+			grad.sparse_gradient(fi,x,g);
+			H.val(k)=g[j];
+		}
+
+		for (int l=0; l<fi.nb_used_vars(); l++) {
+			int j=fi.used_var(l);
+			x[j]=box[j].mid();
+		}
+	}
+}
+
 void Function::print(std::ostream& os) const {
 	if (name!=NULL) os << name << ":";
 	os << "(";
@@ -14,6 +14,7 @@
 
 #include "ibex_Expr.h"
 #include "ibex_Fnc.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_CompiledFunction.h"
 #include "ibex_Decorator.h"
 #include "ibex_Array.h"
@@ -540,6 +541,23 @@ public:
 	template<class V>
 	void backward(const V& algo) const;
 
+	/**
+	 * \brief Run a forward algorithm on the ith node only.
+	 *
+	 * The nodes are numbered as in #node(int) and the arguments
+	 * of the ith node must have been evaluated before.
+	 */
+	template<class V>
+	void forward(const V& algo, int i) const;
+
+	/**
+	 * \brief Run a backward algorithm on the ith node only.
+	 *
+	 * The nodes are numbered as in #node(int).
+	 */
+	template<class V>
+	void backward(const V& algo, int i) const;
+
 	// ======================== for Forward/Backward algorithms ====================
 
 	/**
@@ -621,6 +639,25 @@ public:
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
 	// =============================================================================
 
+	/**
+	 * \brief Sparse structure of the Jacobian matrix.
+	 *
+	 * The entry (i,j) is stored iff the ith component of f depends on the
+	 * jth variable (see #used(int)). All the stored entries are set to [0,0].
+	 */
+	SparseIntervalMatrix jacobian_structure() const;
+
+	/**
+	 * \brief Calculate the Hansen matrix of f in sparse format.
+	 *
+	 * Only the stored entries of h are calculated, by differentiating each
+	 * component w.r.t. its own variables. So the cost is proportional to the
+	 * number of nonzero entries (instead of nb_var() x image_dim()).
+	 *
+	 * \pre h has the structure given by #jacobian_structure().
+	 */
+	void hansen_matrix(const IntervalVector& x, SparseIntervalMatrix& h) const;
+
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
 	 */
@@ -897,6 +934,16 @@ inline void Function::backward(const V& algo) const {
 	cf.backward<V>(algo);
 }
 
+template<class V>
+inline void Function::forward(const V& algo, int i) const {
+	cf.forward<V>(algo,i);
+}
+
+template<class V>
+inline void Function::backward(const V& algo, int i) const {
+	cf.backward<V>(algo,i);
+}
+
 inline bool Function::all_args_scalar() const {
 	return __all_symbols_scalar;
 }
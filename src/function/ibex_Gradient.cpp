@@ -64,6 +64,29 @@ void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVe
 	f.read_arg_domains(g,true);
 }
 
+void Gradient::sparse_gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const {
+	assert(f.expr().dim.is_scalar());
+	assert(f.expr().deco.d);
+	assert(f.expr().deco.g);
+
+	f.eval_domain(box);
+
+	// note: the derivatives of the symbols are
+	// reset by the forward algorithm (see symbol_fwd)
+	try {
+		f.forward<Gradient>(*this);
+	} catch(EmptyBoxException&) {
+		for (int i=0; i<f.nb_used_vars(); i++)
+			g[f.used_var(i)].set_empty();
+		return;
+	}
+
+	f.expr().deco.g->i()=1.0;
+
+	f.backward<Gradient>(*this);
+
+	f.read_arg_domains(g,true);
+}
 
 void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const {
 	assert(f.expr().dim.is_vector());
@@ -34,6 +34,16 @@ public:
 	 */
 	void gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const;
 
+	/**
+	 * \brief Calculate the partial derivatives of f w.r.t. its used variables only.
+	 *
+	 * Same as #gradient(const Function&, const IntervalVector&, IntervalVector&) except that
+	 * g[j] is only set if j is a used variable of f (see #ibex::Fnc::used_var(int)).
+	 * The other entries are left unchanged, so that the cost does not depend on the total
+	 * number of variables.
+	 */
+	void sparse_gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const;
+
 	/**
 	 * \brief Calculate the Jacobian on the domains \a d and store the result in \a J.
 	 */
@@ -0,0 +1,52 @@
+//============================================================================
+//                                  I B E X
+// File        : Contractor for the boundary of a polygon
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcPolygonBoundary.h"
+
+using namespace std;
+
+namespace ibex {
+
+CtcPolygonBoundary::CtcPolygonBoundary(const vector<double>& ax, const vector<double>& ay, const vector<double>& bx, const vector<double>& by) :
+		Ctc(2), index(ax,ay,bx,by), ax(ax), ay(ay), bx(bx), by(by) {
+
+}
+
+void CtcPolygonBoundary::contract(IntervalVector& box) {
+
+	vector<int> list;
+	index.find(box, list);
+
+	IntervalVector result(IntervalVector::empty(2));
+
+	// the box and the endpoints of the segment
+	IntervalVector x(6);
+
+	for (vector<int>::const_iterator it=list.begin(); it!=list.end(); it++) {
+		x[0]=box[0];
+		x[1]=box[1];
+		x[2]=ax[*it];
+		x[3]=ay[*it];
+		x[4]=bx[*it];
+		x[5]=by[*it];
+		try {
+			ctc_segment.contract(x);
+			result[0] |= x[0];
+			result[1] |= x[1];
+		}
+		catch(EmptyBoxException&) {
+		}
+	}
+
+	box = result;
+	if (box.is_empty()) throw EmptyBoxException();
+}
+
+} // end namespace ibex
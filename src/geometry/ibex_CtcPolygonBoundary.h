@@ -0,0 +1,59 @@
+//============================================================================
+//                                  I B E X
+// File        : Contractor for the boundary of a polygon
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_POLYGON_BOUNDARY_H__
+#define __IBEX_CTC_POLYGON_BOUNDARY_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_CtcSegment.h"
+#include "ibex_SegmentIndex.h"
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup geometry
+ *
+ * \brief Minimal contractor for a union of segments (e.g., the boundary of a polygon).
+ *
+ * The result is the same as the union of the contractors #ibex::CtcSegment
+ * of all the segments (see #ibex::CtcUnion) but only the segments whose
+ * bounding box intersects the box are considered. They are found with
+ * a spatial index (see #ibex::SegmentIndex), so that the cost does not depend
+ * on the total number of segments but on the number of segments near the box.
+ */
+class CtcPolygonBoundary : public Ctc {
+public:
+	/**
+	 * \brief Create the contractor for the segments [(ax[i],ay[i]), (bx[i],by[i])].
+	 *
+	 * The coordinates are copied.
+	 */
+	CtcPolygonBoundary(const std::vector<double>& ax, const std::vector<double>& ay, const std::vector<double>& bx, const std::vector<double>& by);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+protected:
+	/** Spatial index of the segments. */
+	SegmentIndex index;
+
+	/** Coordinates of the segments. */
+	std::vector<double> ax, ay, bx, by;
+
+	/** Contractor for "x in [a,b]", where the segment [a,b] is variable. */
+	CtcSegment ctc_segment;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CTC_POLYGON_BOUNDARY_H__
@@ -22,7 +22,7 @@ CtcSegment::CtcSegment(double ax, double ay, double bx, double by) : Ctc(2),
 	X_with_params[5] = Interval(by);
 }
 
-CtcSegment::CtcSegment() : Ctc(6), X_with_params(0 /* unused */) {
+CtcSegment::CtcSegment() : Ctc(6), X_with_params(1 /* unused */) {
 	init();
 }
 
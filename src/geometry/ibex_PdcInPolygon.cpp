@@ -17,48 +17,21 @@ PdcInPolygon::PdcInPolygon(vector<double> &_ax, vector<double> &_ay, vector<doub
     		ax(_ax),
     		ay(_ay),
     		bx(_bx),
-    		by(_by) {
+    		by(_by),
+    		index(_ax,_ay,_bx,_by) {
 }
 
-namespace {
-
-
-Interval argument(Interval mx, Interval my, double xa, double ya, double xb, double yb) {
-	Interval ma_x = Interval(xa) - (mx);
-	Interval ma_y = Interval(ya) - (my);
-	Interval mb_x = Interval(xb) - (mx);
-	Interval mb_y = Interval(yb) - (my);
-
-	Interval norm_ma = sqrt( sqr(ma_x) + sqr(ma_y) );
-	Interval norm_mb = sqrt( sqr(mb_x) + sqr(mb_y) );
-
-	Interval cos_theta = (ma_x*mb_x + ma_y*mb_y) / (norm_ma*norm_mb);
-	Interval sin_theta = (ma_x*mb_y - ma_y*mb_x) / (norm_ma*norm_mb);
-
-	return atan2(sin_theta,cos_theta);
-}
-
-} // end anonymous namespace
-
-
 BoolInterval PdcInPolygon::test(const IntervalVector& x) {
-	
-	Interval mx = Interval(x[0].mid());
-	Interval my = Interval(x[1].mid());
 
-	//Interval cos_theta = 0;
-	Interval theta = Interval(0);
-	for(unsigned int i = 0; i < ax.size(); i++) {
-		theta += argument(mx,my,ax[i],ay[i],bx[i],by[i]);
-	}
+	int w;
 
-	if(!theta.contains(0)) {
+	if (!index.winding_number(x[0].mid(), x[1].mid(), w)) {
+		// Undetermined case (the point may be on the boundary)
+		return MAYBE;
+	} else if (w!=0) {
 		return YES;
-	} else if (!theta.contains(2*M_PI) && theta.contains(0)) {
-		return NO;
 	} else {
-		// Undetermined case
-		return MAYBE;
+		return NO;
 	}
 }
 
@@ -11,6 +11,7 @@
 #define __IBEX_PDC_IN_POLYGON_H__
 
 #include "ibex_Pdc.h"
+#include "ibex_SegmentIndex.h"
 #include <vector>
 
 namespace ibex {
@@ -21,7 +22,10 @@ namespace ibex {
  * \brief Tests if a box is inside a polygon.
  *
  * The test is based on the Winding Number (see .http://en.wikipedia.org/wiki/Winding_number)
- * But fastest method can be found in http://alienryderflex.com/polygon
+ * of the polygon around the midpoint of the box. It is computed by counting the segments
+ * crossing an horizontal half-line (see http://alienryderflex.com/polygon). These segments
+ * are found with a spatial index (see #ibex::SegmentIndex) so that the cost of the test
+ * is logarithmic in the number of segments.
  *
  * The polygon is not necessarily convex.
  *
@@ -62,6 +66,8 @@ public:
      * \param ay list of y coordinate of the first point of each segment
      * \param bx list of x coordinate of the second point of each segment
      * \param by list of y coordinate of the second point of each segment
+     *
+     * The segments must not be modified afterwards.
 	 */
 	PdcInPolygon(std::vector<double>& ax, std::vector<double>& ay, std::vector<double>& bx, std::vector<double>& by);
 
@@ -78,6 +84,11 @@ protected:
     std::vector<double>& ay;
     std::vector<double>& bx;
     std::vector<double>& by;
+
+    /**
+     * Spatial index of the segments
+     */
+    SegmentIndex index;
 };
 
 } // namespace ibex
@@ -0,0 +1,191 @@
+//============================================================================
+//                                  I B E X
+// File        : Spatial index of segments
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SegmentIndex.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+const int SegmentIndex::LEAF_SIZE = 4;
+
+namespace {
+
+/*
+ * Compare two segments by the coordinate of their midpoint
+ * (in the first dimension if xdim is true, in the second one otherwise).
+ */
+class MidpointOrder {
+public:
+	MidpointOrder(const vector<double>& a, const vector<double>& b) : a(a), b(b) { }
+
+	bool operator()(int i, int j) const {
+		return a[i]+b[i] < a[j]+b[j];
+	}
+
+	const vector<double>& a;
+	const vector<double>& b;
+};
+
+} // end anonymous namespace
+
+SegmentIndex::SegmentIndex(const vector<double>& ax, const vector<double>& ay, const vector<double>& bx, const vector<double>& by) :
+		xa(ax), ya(ay), xb(bx), yb(by), id(ax.size()) {
+
+	assert(ay.size()==ax.size() && bx.size()==ax.size() && by.size()==ax.size());
+
+	int n=ax.size();
+
+	for (int i=0; i<n; i++) id[i]=i;
+
+	if (n==0) return;
+
+	nodes.reserve(2*(n/LEAF_SIZE)+1);
+	build(0,n);
+
+	// store the coordinates in the tree order
+	for (int i=0; i<n; i++) {
+		xa[i]=ax[id[i]];
+		ya[i]=ay[id[i]];
+		xb[i]=bx[id[i]];
+		yb[i]=by[id[i]];
+	}
+}
+
+int SegmentIndex::build(int first, int last) {
+	int k=nodes.size();
+	nodes.push_back(Node());
+
+	Node node;
+	node.first=first;
+	node.last=last;
+	node.xmin=node.ymin=POS_INFINITY;
+	node.xmax=node.ymax=NEG_INFINITY;
+
+	// bounding box of the segments and of their midpoints
+	// (the coordinates are still in the initial order here)
+	double cxmin=POS_INFINITY, cxmax=NEG_INFINITY, cymin=POS_INFINITY, cymax=NEG_INFINITY;
+
+	for (int i=first; i<last; i++) {
+		int s=id[i];
+		node.xmin=std::min(node.xmin, std::min(xa[s],xb[s]));
+		node.xmax=std::max(node.xmax, std::max(xa[s],xb[s]));
+		node.ymin=std::min(node.ymin, std::min(ya[s],yb[s]));
+		node.ymax=std::max(node.ymax, std::max(ya[s],yb[s]));
+		cxmin=std::min(cxmin, xa[s]+xb[s]);
+		cxmax=std::max(cxmax, xa[s]+xb[s]);
+		cymin=std::min(cymin, ya[s]+yb[s]);
+		cymax=std::max(cymax, ya[s]+yb[s]);
+	}
+
+	if (last-first<=LEAF_SIZE) {
+		node.left=node.right=-1;
+	} else {
+		int mid=(first+last)/2;
+
+		if (cxmax-cxmin >= cymax-cymin)
+			std::nth_element(id.begin()+first, id.begin()+mid, id.begin()+last, MidpointOrder(xa,xb));
+		else
+			std::nth_element(id.begin()+first, id.begin()+mid, id.begin()+last, MidpointOrder(ya,yb));
+
+		node.left=build(first,mid);
+		node.right=build(mid,last);
+	}
+
+	nodes[k]=node;
+	return k;
+}
+
+void SegmentIndex::find(const IntervalVector& box, vector<int>& res) const {
+	assert(box.size()==2);
+
+	if (nodes.empty() || box.is_empty()) return;
+
+	double xmin=box[0].lb();
+	double xmax=box[0].ub();
+	double ymin=box[1].lb();
+	double ymax=box[1].ub();
+
+	// the depth of the tree is less than 64 (balanced tree)
+	int stack[64];
+	int top=0;
+	stack[top++]=0;
+
+	while (top>0) {
+		const Node& node=nodes[stack[--top]];
+
+		if (node.xmin>xmax || node.xmax<xmin || node.ymin>ymax || node.ymax<ymin)
+			continue;
+
+		if (node.left==-1) {
+			for (int i=node.first; i<node.last; i++) {
+				if (std::min(xa[i],xb[i])<=xmax && std::max(xa[i],xb[i])>=xmin &&
+					std::min(ya[i],yb[i])<=ymax && std::max(ya[i],yb[i])>=ymin)
+					res.push_back(id[i]);
+			}
+		} else {
+			stack[top++]=node.right;
+			stack[top++]=node.left;
+		}
+	}
+}
+
+bool SegmentIndex::winding_number(double x, double y, int& w) const {
+
+	w=0;
+
+	if (nodes.empty()) return true;
+
+	int stack[64];
+	int top=0;
+	stack[top++]=0;
+
+	while (top>0) {
+		const Node& node=nodes[stack[--top]];
+
+		// only the segments with a point on the right of (x,y)
+		// and at the same height can cross the half-line
+		if (node.xmax<x || node.ymin>y || node.ymax<y)
+			continue;
+
+		if (node.left!=-1) {
+			stack[top++]=node.right;
+			stack[top++]=node.left;
+			continue;
+		}
+
+		for (int i=node.first; i<node.last; i++) {
+
+			bool up=(ya[i]<=y && y<yb[i]);
+			bool down=(yb[i]<=y && y<ya[i]);
+
+			if (!up && !down) {
+				// horizontal segment containing the point
+				if (ya[i]==y && yb[i]==y && std::min(xa[i],xb[i])<=x && x<=std::max(xa[i],xb[i]))
+					return false;
+				continue;
+			}
+
+			// position of the point w.r.t. the line (>0 if on the left)
+			Interval side=(Interval(xb[i])-xa[i])*(Interval(y)-ya[i]) - (Interval(yb[i])-ya[i])*(Interval(x)-xa[i]);
+
+			if (side.contains(0)) return false;
+
+			if (up && side.lb()>0) w++;
+			else if (down && side.ub()<0) w--;
+		}
+	}
+	return true;
+}
+
+} // end namespace ibex
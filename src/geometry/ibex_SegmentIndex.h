@@ -0,0 +1,102 @@
+//============================================================================
+//                                  I B E X
+// File        : Spatial index of segments
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SEGMENT_INDEX_H__
+#define __IBEX_SEGMENT_INDEX_H__
+
+#include "ibex_IntervalVector.h"
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup geometry
+ *
+ * \brief Spatial index of a set of segments in the plane.
+ *
+ * The segments are stored in a bounding volume hierarchy: a binary tree
+ * where each node is associated to the bounding box of a subset of segments.
+ * The subset of a node is split in two halves (by the median of the midpoints
+ * of the segments in the largest dimension) to give the two sub-nodes.
+ *
+ * Finding the segments whose bounding box intersects a given box takes
+ * O(log(n)+k) operations for n segments, where k is the number of segments found.
+ */
+class SegmentIndex {
+public:
+	/**
+	 * \brief Create the index of the segments [(ax[i],ay[i]), (bx[i],by[i])].
+	 *
+	 * The coordinates are copied.
+	 */
+	SegmentIndex(const std::vector<double>& ax, const std::vector<double>& ay, const std::vector<double>& bx, const std::vector<double>& by);
+
+	/**
+	 * \brief Number of segments.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Find the segments whose bounding box intersects a box.
+	 *
+	 * The indices of the segments (in the vectors given to the constructor) are
+	 * pushed back in \a res.
+	 */
+	void find(const IntervalVector& box, std::vector<int>& res) const;
+
+	/**
+	 * \brief Winding number of the segments around the point (x,y).
+	 *
+	 * If the segments form closed polygons, this is the number of times
+	 * these polygons turn counter-clockwise around (x,y). Only the segments
+	 * crossing the horizontal half-line starting from (x,y) to the right are
+	 * considered.
+	 *
+	 * \return false if the point (x,y) may be on a segment (the winding number is
+	 *         then undetermined). The orientation tests are performed with interval arithmetic.
+	 */
+	bool winding_number(double x, double y, int& w) const;
+
+protected:
+	/* A node of the tree. */
+	struct Node {
+		// bounding box of the segments of the node
+		double xmin, xmax, ymin, ymax;
+		// the segments of the node (in the tree order)
+		int first, last;
+		// sub-nodes (-1 for a leaf)
+		int left, right;
+	};
+
+	/* Maximal number of segments in a leaf */
+	static const int LEAF_SIZE;
+
+	/* Build the node of the segments first,...,last-1 (in the tree order). */
+	int build(int first, int last);
+
+	/* The coordinates of the segments, in the tree order */
+	std::vector<double> xa, ya, xb, yb;
+
+	/* The index of each segment (in the vectors given to the constructor) */
+	std::vector<int> id;
+
+	/* The nodes (the root is the first one) */
+	std::vector<Node> nodes;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SegmentIndex::size() const {
+	return id.size();
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SEGMENT_INDEX_H__
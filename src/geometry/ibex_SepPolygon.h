@@ -12,7 +12,7 @@
 #define __IBEX_SEP_POLYGON_H__
 
 #include "ibex_SepBoundaryCtc.h"
-#include "ibex_CtcUnion.h"
+#include "ibex_CtcPolygonBoundary.h"
 #include "ibex_PdcInPolygon.h"
 
 using namespace std;
@@ -72,7 +72,8 @@ public:
      * See unit test for an example of usage
      *
      * The polygon boundary contractor is composed of a union of
-     * contractor on segments (CtcSegment).
+     * contractor on segments (CtcSegment), restricted to the segments
+     * near the box (see #ibex::CtcPolygonBoundary).
      * This contractor is minimal as an union of minimal contractors.
      * See #ibex::SepBoundaryCtc.
      *
@@ -0,0 +1,495 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_DualSimplex.h"
+#include "ibex_Interval.h"
+
+#include <cmath>
+#include <ctime>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// pivots smaller than this are rejected
+const double pivot_tol = 1e-9;
+
+// tolerance on the sign of the reduced costs
+const double dual_tol = 1e-9;
+
+// the basis is factorized again every "refactor" iterations
+const int refactor = 50;
+
+inline bool is_finite(double v) {
+	return v>NEG_INFINITY && v<POS_INFINITY;
+}
+
+/*
+ * A breakpoint of the dual ratio test
+ */
+struct Breakpoint {
+	int k;         // variable
+	double ratio;  // d_k/alpha_k
+	double alpha;  // |alpha_k|
+	bool operator<(const Breakpoint& b) const { return ratio<b.ratio; }
+};
+
+} // end anonymous namespace
+
+DualSimplex::DualSimplex(int n) : nb_iter(0), n(n), m(0), c(n,0.0),
+		clb(n,NEG_INFINITY), cub(n,POS_INFINITY), status(n,AT_ZERO),
+		x(n,0.0), d(n,0.0), factorized(true), cold(true), obj(0.0) {
+
+}
+
+void DualSimplex::set_obj(int j, double cj) {
+	c[j]=cj;
+}
+
+void DualSimplex::set_bounds(int j, double lb, double ub) {
+	clb[j]=lb;
+	cub[j]=ub;
+}
+
+void DualSimplex::add_row(const double* a, double lhs, double rhs) {
+	A.insert(A.end(), a, a+n);
+	rlb.push_back(lhs);
+	rub.push_back(rhs);
+	// the new logical variable is basic: the basis remains
+	// nonsingular (but has to be factorized again).
+	status.push_back(BASIC);
+	head.push_back(n+m);
+	x.push_back(0.0);
+	d.push_back(0.0);
+	y.push_back(0.0);
+	m++;
+	factorized=false;
+}
+
+void DualSimplex::set_row(int i, const double* a, double lhs, double rhs) {
+	assert(i>=0 && i<m);
+	for (int j=0; j<n; j++) {
+		if (A[i*n+j]!=a[j]) {
+			A[i*n+j]=a[j];
+			factorized=false;
+		}
+	}
+	rlb[i]=lhs;
+	rub[i]=rhs;
+}
+
+void DualSimplex::remove_rows(int i0) {
+	assert(i0>=0 && i0<=m);
+	if (i0==m) return;
+
+	// if all the removed logical variables are basic, the remaining basis
+	// is still nonsingular (expand the determinant along their columns).
+	vector<int> head2;
+	for (int i=0; i<m; i++)
+		if (head[i]<n+i0) head2.push_back(head[i]);
+
+	if ((int) head2.size()!=i0) cold=true;
+	else head=head2;
+
+	A.resize(i0*n);
+	rlb.resize(i0);
+	rub.resize(i0);
+	status.resize(n+i0);
+	x.resize(n+i0);
+	d.resize(n+i0);
+	y.resize(i0);
+	m=i0;
+	factorized=false;
+}
+
+double DualSimplex::column_dot(const vector<double>& v, int k) const {
+	if (k<n) {
+		double s=0;
+		for (int i=0; i<m; i++) s+=v[i]*A[i*n+k];
+		return s;
+	} else
+		return -v[k-n];
+}
+
+void DualSimplex::set_nonbasic(int k) {
+	// a nonbasic variable is put on a finite bound (if any)
+	switch (status[k]) {
+	case AT_LB:
+		if (!is_finite(lo(k))) status[k]=is_finite(up(k))? AT_UB : AT_ZERO;
+		break;
+	case AT_UB:
+		if (!is_finite(up(k))) status[k]=is_finite(lo(k))? AT_LB : AT_ZERO;
+		break;
+	case AT_ZERO:
+		if (is_finite(lo(k))) status[k]=AT_LB;
+		else if (is_finite(up(k))) status[k]=AT_UB;
+		break;
+	default:
+		break;
+	}
+	switch (status[k]) {
+	case AT_LB : x[k]=lo(k); break;
+	case AT_UB : x[k]=up(k); break;
+	default    : x[k]=0.0;
+	}
+}
+
+bool DualSimplex::factorize() {
+
+	// Gauss-Jordan elimination with partial pivoting
+	vector<double> B(m*m,0.0);
+	Binv.assign(m*m,0.0);
+
+	for (int i=0; i<m; i++) {
+		Binv[i*m+i]=1.0;
+		int k=head[i];
+		if (k<n)
+			for (int l=0; l<m; l++) B[l*m+i]=A[l*n+k];
+		else
+			B[(k-n)*m+i]=-1.0;
+	}
+
+	for (int col=0; col<m; col++) {
+		int p=col;
+		for (int l=col+1; l<m; l++)
+			if (fabs(B[l*m+col])>fabs(B[p*m+col])) p=l;
+
+		if (fabs(B[p*m+col])<1e-12) return false;
+
+		if (p!=col)
+			for (int l=0; l<m; l++) {
+				swap(B[p*m+l],B[col*m+l]);
+				swap(Binv[p*m+l],Binv[col*m+l]);
+			}
+
+		double piv=B[col*m+col];
+		for (int l=0; l<m; l++) {
+			B[col*m+l]/=piv;
+			Binv[col*m+l]/=piv;
+		}
+
+		for (int r=0; r<m; r++) {
+			if (r==col) continue;
+			double f=B[r*m+col];
+			if (f==0) continue;
+			for (int l=0; l<m; l++) {
+				B[r*m+l]-=f*B[col*m+l];
+				Binv[r*m+l]-=f*Binv[col*m+l];
+			}
+		}
+	}
+
+	factorized=true;
+	return true;
+}
+
+bool DualSimplex::slack_basis() {
+	head.resize(m);
+	for (int i=0; i<m; i++) {
+		head[i]=n+i;
+		status[n+i]=BASIC;
+	}
+
+	Binv.assign(m*m,0.0);
+	for (int i=0; i<m; i++) Binv[i*m+i]=-1.0;
+	factorized=true;
+	cold=false;
+
+	// the reduced costs are the costs: each variable
+	// is put on the bound that makes it dual feasible.
+	for (int j=0; j<n; j++) {
+		if (c[j]>0) {
+			if (!is_finite(clb[j])) return false;
+			status[j]=AT_LB;
+		} else if (c[j]<0) {
+			if (!is_finite(cub[j])) return false;
+			status[j]=AT_UB;
+		} else
+			status[j]=AT_ZERO;
+		set_nonbasic(j);
+	}
+	return true;
+}
+
+void DualSimplex::compute_primal() {
+	// B x_B + N x_N = 0 where the columns of the logical variables are -e_i
+	vector<double> v(m,0.0);
+
+	for (int k=0; k<n+m; k++) {
+		if (status[k]==BASIC) continue;
+		set_nonbasic(k);
+		if (x[k]==0) continue;
+		if (k<n)
+			for (int i=0; i<m; i++) v[i]-=A[i*n+k]*x[k];
+		else
+			v[k-n]+=x[k];
+	}
+
+	for (int i=0; i<m; i++) {
+		double s=0;
+		for (int l=0; l<m; l++) s+=Binv[i*m+l]*v[l];
+		x[head[i]]=s;
+	}
+}
+
+void DualSimplex::compute_dual() {
+	// y^T = c_B^T Binv (the cost of a logical variable is 0)
+	for (int l=0; l<m; l++) {
+		double s=0;
+		for (int i=0; i<m; i++)
+			if (head[i]<n) s+=c[head[i]]*Binv[i*m+l];
+		y[l]=s;
+	}
+
+	for (int k=0; k<n+m; k++)
+		d[k]= status[k]==BASIC? 0 : (k<n? c[k] : 0) - column_dot(y,k);
+}
+
+bool DualSimplex::make_dual_feasible() {
+	// a nonbasic variable with a reduced cost of the wrong sign
+	// is moved to its other bound, if possible.
+	for (int k=0; k<n+m; k++) {
+		switch (status[k]) {
+		case AT_LB:
+			if (d[k]<-dual_tol) {
+				if (!is_finite(up(k))) return false;
+				status[k]=AT_UB;
+			}
+			break;
+		case AT_UB:
+			if (d[k]>dual_tol) {
+				if (!is_finite(lo(k))) return false;
+				status[k]=AT_LB;
+			}
+			break;
+		case AT_ZERO:
+			if (fabs(d[k])>dual_tol) return false;
+			break;
+		default:
+			break;
+		}
+	}
+	return true;
+}
+
+DualSimplex::Status DualSimplex::solve(int max_iter, double max_time, double eps) {
+
+	clock_t start=clock();
+
+	y.resize(m);
+
+	// ============== initial basis ===================
+	if (m==0) {
+		head.clear();
+		Binv.clear();
+		factorized=true;
+		cold=false;
+	}
+
+	for (int k=0; k<n+m; k++)
+		if (status[k]!=BASIC) set_nonbasic(k);
+
+	if (cold || (!factorized && !factorize())) {
+		if (!slack_basis()) return UNKNOWN;
+	}
+
+	compute_dual();
+
+	if (!make_dual_feasible()) {
+		if (!slack_basis()) return UNKNOWN;
+		compute_dual();
+	}
+
+	compute_primal();
+
+	vector<double> rho(m);      // pivot row of Binv
+	vector<double> alpha(n+m);  // pivot row of Binv.[A -I]
+	vector<double> col(m);      // entering column
+	vector<double> v(m);
+	vector<Breakpoint> bp;
+
+	for (int iter=0; ; iter++) {
+
+		// =========== choice of the leaving variable ===========
+		// (dual steepest edge)
+		int p=-1;
+		double best=0;
+		for (int i=0; i<m; i++) {
+			int k=head[i];
+			double infeas;
+			if (x[k]<lo(k)-eps*std::max(1.0,fabs(lo(k))))
+				infeas=lo(k)-x[k];
+			else if (x[k]>up(k)+eps*std::max(1.0,fabs(up(k))))
+				infeas=x[k]-up(k);
+			else
+				continue;
+
+			double w=0;
+			for (int l=0; l<m; l++) w+=Binv[i*m+l]*Binv[i*m+l];
+			if (infeas*infeas>best*w) {
+				best=infeas*infeas/w;
+				p=i;
+			}
+		}
+
+		if (p==-1) {
+			// optimal
+			compute_dual();
+			obj=0;
+			for (int j=0; j<n; j++) obj+=c[j]*x[j];
+			return OPTIMAL;
+		}
+
+		if (iter>=max_iter) return MAX_ITER;
+
+		if (((double) (clock()-start))/CLOCKS_PER_SEC>max_time) return TIME_OUT;
+
+		int kp=head[p];
+		// dir=-1: the leaving variable goes to its lower bound
+		// dir=+1: the leaving variable goes to its upper bound
+		int dir=x[kp]<lo(kp)? -1 : 1;
+		double target=dir==-1? lo(kp) : up(kp);
+
+		// =========== pivot row ===========
+		for (int l=0; l<m; l++) rho[l]=Binv[p*m+l];
+
+		bp.clear();
+		for (int k=0; k<n+m; k++) {
+			if (status[k]==BASIC) continue;
+			alpha[k]=column_dot(rho,k);
+			double a=dir*alpha[k];
+			if ((status[k]==AT_LB && a>pivot_tol) || (status[k]==AT_UB && a<-pivot_tol) ||
+				(status[k]==AT_ZERO && fabs(a)>pivot_tol)) {
+				Breakpoint b;
+				b.k=k;
+				b.ratio=std::max(0.0,d[k]/a);
+				b.alpha=fabs(a);
+				bp.push_back(b);
+			}
+		}
+
+		if (bp.empty()) {
+			// dual unbounded: rho is a certificate of infeasibility
+			// (the coefficients ignored by the ratio test are ignored
+			// here as well, as they may multiply an infinite bound).
+			for (int l=0; l<m; l++) y[l]=fabs(rho[l])>pivot_tol? rho[l] : 0;
+			return INFEASIBLE;
+		}
+
+		// =========== bound flipping ratio test ===========
+		sort(bp.begin(),bp.end());
+
+		double slope=fabs(x[kp]-target);
+		unsigned int b=0;
+		for (; b<bp.size()-1; b++) {
+			int k=bp[b].k;
+			if (status[k]==AT_ZERO || !is_finite(lo(k)) || !is_finite(up(k))) break;
+			double s=slope-bp[b].alpha*(up(k)-lo(k));
+			if (s<=0) break;
+			slope=s;
+		}
+
+		// among the breakpoints with (almost) the same ratio,
+		// the one with the largest pivot is chosen
+		unsigned int q=b;
+		for (unsigned int b2=b+1; b2<bp.size() && bp[b2].ratio<=bp[b].ratio+dual_tol; b2++)
+			if (bp[b2].alpha>bp[q].alpha) q=b2;
+
+		int kq=bp[q].k;
+		double theta_d=bp[q].ratio;
+
+		// =========== update of the reduced costs ===========
+		for (int k=0; k<n+m; k++)
+			if (status[k]!=BASIC) d[k]-=theta_d*dir*alpha[k];
+		d[kq]=0;
+		d[kp]=-dir*theta_d;
+
+		// =========== bound flips ===========
+		bool flip=false;
+		for (int l=0; l<m; l++) v[l]=0;
+		for (unsigned int b2=0; b2<b; b2++) {
+			int k=bp[b2].k;
+			if (k==kq) continue;
+			double delta;
+			if (status[k]==AT_LB) { status[k]=AT_UB; delta=up(k)-lo(k); x[k]=up(k); }
+			else                  { status[k]=AT_LB; delta=lo(k)-up(k); x[k]=lo(k); }
+			if (k<n)
+				for (int l=0; l<m; l++) v[l]+=A[l*n+k]*delta;
+			else
+				v[k-n]-=delta;
+			flip=true;
+		}
+		if (flip) {
+			for (int i=0; i<m; i++) {
+				double s=0;
+				for (int l=0; l<m; l++) s+=Binv[i*m+l]*v[l];
+				x[head[i]]-=s;
+			}
+		}
+
+		// =========== entering column ===========
+		for (int i=0; i<m; i++) {
+			if (kq<n) {
+				double s=0;
+				for (int l=0; l<m; l++) s+=Binv[i*m+l]*A[l*n+kq];
+				col[i]=s;
+			} else
+				col[i]=-Binv[i*m+kq-n];
+		}
+
+		if (fabs(col[p])<pivot_tol) {
+			// the pivot computed from the row and the column
+			// do not match: the basis is factorized again.
+			if (!factorize()) return UNKNOWN;
+			compute_primal();
+			compute_dual();
+			if (!make_dual_feasible()) return UNKNOWN;
+			compute_primal();
+			nb_iter++;
+			continue;
+		}
+
+		// =========== primal update ===========
+		double theta_p=(x[kp]-target)/col[p];
+		for (int i=0; i<m; i++)
+			x[head[i]]-=theta_p*col[i];
+		x[kq]+=theta_p;
+		x[kp]=target;
+
+		status[kp]= dir==-1? AT_LB : AT_UB;
+		status[kq]=BASIC;
+		head[p]=kq;
+
+		// =========== update of the inverse ===========
+		double piv=col[p];
+		for (int l=0; l<m; l++) Binv[p*m+l]/=piv;
+		for (int i=0; i<m; i++) {
+			if (i==p || col[i]==0) continue;
+			double f=col[i];
+			for (int l=0; l<m; l++) Binv[i*m+l]-=f*Binv[p*m+l];
+		}
+
+		nb_iter++;
+
+		if ((iter+1)%refactor==0) {
+			if (!factorize()) return UNKNOWN;
+			compute_primal();
+			compute_dual();
+			if (!make_dual_feasible()) return UNKNOWN;
+			compute_primal();
+		}
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,256 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_DUAL_SIMPLEX_H__
+#define __IBEX_DUAL_SIMPLEX_H__
+
+#include <vector>
+#include <cstddef>
+
+namespace ibex {
+
+/** \ingroup numeric
+ *
+ * \brief Built-in linear solver (bounded dual simplex).
+ *
+ * Solve the linear program
+ * <pre>
+ *     min c.x  s.t.  lb <= x <= ub,  lhs <= Ax <= rhs
+ * </pre>
+ * where bounds may be infinite. This is the linear solver used by
+ * #ibex::LinearSolver when Ibex is configured without external LP solver.
+ *
+ * It is designed for the small and dense linear programs of
+ * #ibex::CtcPolytopeHull, that are solved many times with different
+ * objectives, bounds and coefficients:
+ * <ul>
+ * <li> the matrix A and the inverse of the basis are dense;
+ * <li> the optimal basis is kept from one call to #solve(int,double,double) to the next one (warm start).
+ *      A change of bounds (of the variables or the constraints) keeps the basis
+ *      factorized. A change in the objective only requires nonbasic variables to
+ *      be moved to their other bound. A change of coefficients requires
+ *      the basis to be factorized again. The basis is replaced by the slack basis
+ *      only if it becomes singular or not dual feasible;
+ * <li> the ratio test is the "bound flipping" ratio test (the boxed nonbasic variables
+ *      are moved to their opposite bound instead of entering the basis when
+ *      this improves the dual objective) and the leaving variable is chosen with
+ *      the dual steepest-edge rule.
+ * </ul>
+ *
+ * A variable is expected to be bounded on the side given by the sign of
+ * its cost (otherwise the slack basis is not dual feasible and #UNKNOWN
+ * is returned). This is the case in #ibex::CtcPolytopeHull where all the variables
+ * are bounded.
+ */
+class DualSimplex {
+public:
+
+	/**
+	 * \brief Status of #solve(int,double,double).
+	 */
+	typedef enum { OPTIMAL, INFEASIBLE, MAX_ITER, TIME_OUT, UNKNOWN } Status;
+
+	/**
+	 * \brief Create a linear program with n variables and no constraint.
+	 *
+	 * Initially, the objective is 0 and the variables are unbounded.
+	 */
+	DualSimplex(int n);
+
+	/**
+	 * \brief Number of variables.
+	 */
+	int nb_var() const;
+
+	/**
+	 * \brief Number of constraints (rows).
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Set the cost of the jth variable.
+	 */
+	void set_obj(int j, double c);
+
+	/**
+	 * \brief Set the bounds of the jth variable.
+	 */
+	void set_bounds(int j, double lb, double ub);
+
+	/**
+	 * \brief Lower bound of the jth variable.
+	 */
+	double lb(int j) const;
+
+	/**
+	 * \brief Upper bound of the jth variable.
+	 */
+	double ub(int j) const;
+
+	/**
+	 * \brief Add the constraint lhs <= a.x <= rhs.
+	 *
+	 * \param a - array of #nb_var() coefficients.
+	 */
+	void add_row(const double* a, double lhs, double rhs);
+
+	/**
+	 * \brief Replace the ith constraint by lhs <= a.x <= rhs.
+	 */
+	void set_row(int i, const double* a, double lhs, double rhs);
+
+	/**
+	 * \brief Remove the constraints i, i+1, ..., #nb_rows()-1.
+	 */
+	void remove_rows(int i);
+
+	/**
+	 * \brief Coefficients of the ith constraint.
+	 */
+	const double* row(int i) const;
+
+	/**
+	 * \brief Left-hand side of the ith constraint.
+	 */
+	double lhs(int i) const;
+
+	/**
+	 * \brief Right-hand side of the ith constraint.
+	 */
+	double rhs(int i) const;
+
+	/**
+	 * \brief Solve the linear program.
+	 *
+	 * \param max_iter - maximal number of iterations
+	 * \param max_time - timeout (in seconds)
+	 * \param eps      - feasibility tolerance (relative to the magnitude of the bounds)
+	 *
+	 * \return OPTIMAL, INFEASIBLE (the problem is infeasible, see #farkas()),
+	 * MAX_ITER, TIME_OUT or UNKNOWN (numerical failure or
+	 * no dual feasible basis could be found).
+	 */
+	Status solve(int max_iter, double max_time, double eps);
+
+	/**
+	 * \brief Optimal value (after #OPTIMAL).
+	 */
+	double obj_value() const;
+
+	/**
+	 * \brief Optimal solution (after #OPTIMAL).
+	 *
+	 * Array of #nb_var() values.
+	 */
+	const double* primal() const;
+
+	/**
+	 * \brief Dual solution of the constraints (after #OPTIMAL).
+	 *
+	 * Array y of #nb_rows() values such that c=A^T y + d where d
+	 * are the reduced costs (see #reduced_costs()). The ith value is
+	 * positive (resp. negative) only if the ith constraint is
+	 * active at its lhs (resp. rhs).
+	 */
+	const double* dual() const;
+
+	/**
+	 * \brief Reduced costs of the variables (after #OPTIMAL).
+	 *
+	 * Array of #nb_var() values. This is the dual solution of the
+	 * constraints lb <= x <= ub (see #dual()).
+	 */
+	const double* reduced_costs() const;
+
+	/**
+	 * \brief Infeasibility certificate (after #INFEASIBLE).
+	 *
+	 * Array r of #nb_rows() values such that the interval
+	 * (A^T r).[lb,ub] does not intersect r.[lhs,rhs], up to rounding
+	 * errors.
+	 */
+	const double* farkas() const;
+
+	/**
+	 * \brief Total number of iterations (statistic).
+	 */
+	long nb_iter;
+
+protected:
+	/* status of a variable */
+	typedef enum { BASIC, AT_LB, AT_UB, AT_ZERO } VarStatus;
+
+	/* variables k<n are the structural ones, variables k>=n
+	 * are the logical ones (s_i=a_i.x, one per row). */
+	double lo(int k) const;
+	double up(int k) const;
+
+	bool factorize();
+	bool slack_basis();
+	bool make_dual_feasible();
+	void compute_primal();
+	void compute_dual();
+	void set_nonbasic(int k);
+	double column_dot(const std::vector<double>& v, int k) const;
+
+	int n;                      // number of variables
+	int m;                      // number of rows
+	std::vector<double> c;      // costs
+	std::vector<double> clb;    // bounds of the variables
+	std::vector<double> cub;
+	std::vector<double> A;      // matrix (row-major)
+	std::vector<double> rlb;    // bounds of the rows
+	std::vector<double> rub;
+
+	std::vector<int> status;    // status of the n+m variables
+	std::vector<int> head;      // basic variable of each row of the basis
+	std::vector<double> Binv;   // inverse of the basis (row-major)
+	std::vector<double> x;      // values of the n+m variables
+	std::vector<double> d;      // reduced costs of the n+m variables
+	std::vector<double> y;      // dual solution (or infeasibility certificate)
+
+	bool factorized;            // Binv is up to date w.r.t. A and head
+	bool cold;                  // the basis has to be replaced by the slack basis
+	double obj;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int DualSimplex::nb_var() const { return n; }
+
+inline int DualSimplex::nb_rows() const { return m; }
+
+inline double DualSimplex::lb(int j) const { return clb[j]; }
+
+inline double DualSimplex::ub(int j) const { return cub[j]; }
+
+inline const double* DualSimplex::row(int i) const { return &A[i*n]; }
+
+inline double DualSimplex::lhs(int i) const { return rlb[i]; }
+
+inline double DualSimplex::rhs(int i) const { return rub[i]; }
+
+inline double DualSimplex::obj_value() const { return obj; }
+
+inline const double* DualSimplex::primal() const { return &x[0]; }
+
+inline const double* DualSimplex::dual() const { return m>0? &y[0] : NULL; }
+
+inline const double* DualSimplex::reduced_costs() const { return &d[0]; }
+
+inline const double* DualSimplex::farkas() const { return m>0? &y[0] : NULL; }
+
+inline double DualSimplex::lo(int k) const { return k<n? clb[k] : rlb[k-n]; }
+
+inline double DualSimplex::up(int k) const { return k<n? cub[k] : rub[k-n]; }
+
+} // end namespace ibex
+
+#endif // __IBEX_DUAL_SIMPLEX_H__
@@ -10,6 +10,8 @@
 
 #include <math.h>
 #include <float.h>
+#include <vector>
+#include <algorithm>
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
 
@@ -226,11 +228,9 @@ void real_inverse(const Matrix& A, Matrix& invA) {
 	delete[] p;
 }
 
-void precond(IntervalMatrix& A) {
-	int n=(A.nb_rows());
-	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+void precond_matrix(const IntervalMatrix& A, Matrix& C) {
+	assert(A.nb_rows() == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 
-	Matrix C(n,n);
 	try { real_inverse(A.mid(), C); }
 	catch (SingularMatrixException&) {
 		try { real_inverse(A.lb(), C); }
@@ -238,29 +238,36 @@ void precond(IntervalMatrix& A) {
 			real_inverse(A.ub(), C);
 		}
 	}
+}
+
+void precond(IntervalMatrix& A, bool mid_rad) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 
-	A = C*A;
+	Matrix C(n,n);
+	precond_matrix(A, C);
+
+	A = mid_rad? mul_mid_rad(C,A) : C*A;
 }
 
-void precond(IntervalMatrix& A, IntervalVector& b) {
+void precond(IntervalMatrix& A, IntervalVector& b, bool mid_rad) {
 	int n=(A.nb_rows());
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 	assert(n == b.size());
 
 	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	precond_matrix(A, C);
 
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
 	//cout << "C=" << C << endl;
-	A = C*A;
-	b = C*b;
+	if (mid_rad) {
+		A = mul_mid_rad(C,A);
+		b = mul_mid_rad(C,b);
+	} else {
+		A = C*A;
+		b = C*b;
+	}
 }
 
 // static void lu_interval(IntervalMatrix& A, int i, int n, Interval& det) {
@@ -395,5 +402,163 @@ void hansen_bliek(const IntervalMatrix& A, const IntervalVector& B, IntervalVect
 	}
 }
 
+int default_precond_block_size=8;
+
+namespace {
+
+/*
+ * Inverse of the diagonal block [s..e]x[s..e] of A
+ * (same fallbacks as the dense preconditioning).
+ */
+void block_inverse(const SparseIntervalMatrix& A, int s, int e, Matrix& C) {
+	IntervalMatrix D=A.submatrix(s,e,s,e);
+
+	try { real_inverse(D.mid(), C); }
+	catch (SingularMatrixException&) {
+		try { real_inverse(D.lb(), C); }
+		catch (SingularMatrixException&) {
+			real_inverse(D.ub(), C);
+		}
+	}
+}
+
+void sparse_precond(SparseIntervalMatrix& A, IntervalVector* b, int block_size) {
+	int n=A.nb_rows();
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+	assert(!b || n == b->size());
+	assert(block_size>0);
+
+	// CSR arrays of C*A
+	vector<int> row_start(n+1);
+	vector<int> col_index;
+	vector<Interval> val;
+	col_index.reserve(A.nb_nonzeros());
+	val.reserve(A.nb_nonzeros());
+
+	// sparse accumulator for a row of C*A
+	vector<Interval> acc(n,Interval::ZERO);
+	vector<bool> used(n,false);
+	vector<int> pattern;
+
+	for (int s=0; s<n; s+=block_size) {
+		int e=(s+block_size<n? s+block_size : n)-1;
+		int bs=e-s+1;
+
+		Matrix C(bs,bs);
+		block_inverse(A,s,e,C); // may throw SingularMatrixException
+
+		// all the rows of the block share the same
+		// pattern: the union of the patterns of A's rows
+		pattern.clear();
+		for (int r=s; r<=e; r++)
+			for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+				int j=A.index(k);
+				if (!used[j]) { used[j]=true; pattern.push_back(j); }
+			}
+		sort(pattern.begin(),pattern.end());
+
+		for (int i=0; i<bs; i++) {
+			row_start[s+i]=(int) col_index.size();
+
+			for (int r=0; r<bs; r++) {
+				if (C[i][r]==0) continue;
+				for (int k=A.row_begin(s+r); k<A.row_end(s+r); k++)
+					acc[A.index(k)] += C[i][r]*A.val(k);
+			}
+
+			for (vector<int>::const_iterator it=pattern.begin(); it!=pattern.end(); it++) {
+				Interval& a=acc[*it];
+				if (a.lb()!=0 || a.ub()!=0) {
+					col_index.push_back(*it);
+					val.push_back(a);
+				}
+				a=Interval::ZERO;
+			}
+		}
+
+		for (vector<int>::const_iterator it=pattern.begin(); it!=pattern.end(); it++)
+			used[*it]=false;
+
+		if (b) b->put(s, C*b->subvector(s,e));
+	}
+	row_start[n]=(int) col_index.size();
+
+	if (col_index.empty()) throw SingularMatrixException();
+
+	A=SparseIntervalMatrix(n,n,&row_start[0],&col_index[0],&val[0]);
+}
+
+} // end anonymous namespace
+
+void precond(SparseIntervalMatrix& A, int block_size) {
+	sparse_precond(A,NULL,block_size);
+}
+
+void precond(SparseIntervalMatrix& A, IntervalVector& b, int block_size) {
+	sparse_precond(A,&b,block_size);
+}
+
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols())); // throw NotSquareMatrixException();
+	assert(n == (x.size()) && n == (b.size()));
+
+	double red;
+	Interval old, proj, tmp;
+
+	do {
+		red = 0;
+		for (int i=0; i<n; i++) {
+			old = x[i];
+			proj = b[i];
+			tmp = Interval::ZERO;
+
+			for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+				int j=A.index(k);
+				if (j!=i) proj -= A.val(k)*x[j];
+				else tmp=A.val(k);
+			}
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+}
+
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols()));
+	assert(n == (x.size()) && n == (b.size()));
+	assert(min_dist>0);
+
+	IntervalVector xold(n);
+	Interval proj, diag;
+	double d=DBL_MAX; // Hausdorff distances between 2 iterations
+	double dold;
+	double mu; // ratio of dist(x_k,x_{k-1)) / dist(x_{k-1},x_{k-2}).
+	do {
+		dold = d;
+		xold = x;
+		for (int i=0; i<n; i++) {
+			proj = b[i];
+			diag = Interval::ZERO;
+			for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+				int j=A.index(k);
+				if (j!=i) proj -= A.val(k)*x[j];
+				else diag=A.val(k);
+			}
+			x[i] = proj/diag;
+		}
+		d=distance(xold,x);
+		mu=d/dold;
+	} while (mu<mu_max && d>min_dist);
+
+	return (mu<mu_max);
+}
+
 } // end namespace
 
@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -97,11 +98,15 @@ void real_inverse(const Matrix& A, Matrix& invA);
  *
  * \param A (in/output)- The interval matrix [A] to be replaced by \f$C^{-1}[A]\f$.
  * \param b (in/output)- The interval vector [b] to be replaced by \f$C^{-1}[b]\f$.
+ * \param mid_rad (optional) - If true, the products are computed with midpoint-radius
+ *                  arithmetic (see #mul_mid_rad(const Matrix&, const IntervalMatrix&)).
+ *                  This is faster on large matrices but the enclosure is slightly larger
+ *                  (relative error of order n*eps). False by default.
  *
  * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
  *
  */
-void precond(IntervalMatrix& A, IntervalVector& b);
+void precond(IntervalMatrix& A, IntervalVector& b, bool mid_rad=false);
 
 /**
  * \ingroup numeric
@@ -113,11 +118,23 @@ void precond(IntervalMatrix& A, IntervalVector& b);
  * \c Mid([A]), \c Inf([A]) or \c Sup([A]).
  *
  * \param A (in/output)- The interval matrix [A] to be replaced by \f$C^{-1}[A]\f$.
+ * \param mid_rad (optional) - See #precond(IntervalMatrix&, IntervalVector&, bool).
  *
  * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
  *
  */
-void precond(IntervalMatrix& A);
+void precond(IntervalMatrix& A, bool mid_rad=false);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief The preconditioning matrix of \f$[A]\f$.
+ *
+ * Compute the matrix \f$C^{-1}\f$ used by #precond(IntervalMatrix&, IntervalVector&).
+ *
+ * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
+ */
+void precond_matrix(const IntervalMatrix& A, Matrix& invC);
 /**
  * \ingroup numeric
  *
@@ -182,6 +199,63 @@ bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, In
  */
 void hansen_bliek(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x);
 
+/**
+ * \brief Default size of diagonal blocks for sparse preconditioning.
+ */
+extern int default_precond_block_size;
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Preconditions the sparse system \f$[A]x=[b]\f$.
+ *
+ * <br> Precondition is made by multiplying [A] and [b] with a
+ * block-diagonal matrix C. The ith diagonal block of C is the
+ * inverse of the ith diagonal block of either (in priority)
+ * \c Mid([A]), \c Inf([A]) or \c Sup([A]). Blocks are made of
+ * \a block_size consecutive rows/columns (the last one may be smaller).
+ *
+ * Contrary to the dense version, the sparsity of [A] is preserved
+ * (up to the fill-in inside block rows). With block_size=n, C is
+ * the full inverse of \c Mid([A]).
+ *
+ * \param A (in/output)- The interval matrix [A] to be replaced by \f$C[A]\f$.
+ * \param b (in/output)- The interval vector [b] to be replaced by \f$C[b]\f$.
+ *
+ * \throw SingularMatrixException if no real matrix extracted from a diagonal block of [A] could be inversed successfully.
+ */
+void precond(SparseIntervalMatrix& A, IntervalVector& b, int block_size=default_precond_block_size);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Precondition the sparse matrix \f$[A]\f$.
+ *
+ * See #ibex::precond(SparseIntervalMatrix&, IntervalVector&, int).
+ */
+void precond(SparseIntervalMatrix& A, int block_size=default_precond_block_size);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Gauss-Seidel algorithm (sparse matrix).
+ *
+ * Same as #ibex::gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * but each sweep is linear in the number of nonzero entries of [A].
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Gauss-Seidel algorithm (inflating variant, sparse matrix).
+ *
+ * Same as #ibex::inflating_gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double, double)
+ * but each sweep is linear in the number of nonzero entries of [A].
+ */
+bool inflating_gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist=1e-12, double mu_max_divergence=1.0);
+
+
 
 } // end namespace
 
@@ -73,7 +73,7 @@ double LinearSolver::getEpsilon() const {
 
 
 LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_out, double eps) :
-			nb_ctrs(nb_ctr), nb_vars(nb_vars1), nb_rows(0), obj_value(0.0), epsilon(eps),
+			nb_ctrs(nb_ctr), nb_vars(nb_vars1), nb_rows(0), nb_lp_rows(0), obj_value(0.0), epsilon(eps),
 			primal_solution(new double[nb_vars1]), dual_solution(NULL),
 			status_prim(soplex::SPxSolver::UNKNOWN), status_dual(soplex::SPxSolver::UNKNOWN)  {
 
@@ -100,6 +100,7 @@ LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_
 	}
 
 	nb_rows += nb_vars;
+	nb_lp_rows = nb_rows;
 
 }
 
@@ -109,12 +110,20 @@ LinearSolver::~LinearSolver() {
 	delete mysoplex;
 }
 
+void LinearSolver::removeUnusedRows() {
+	if (nb_lp_rows>nb_rows) {
+		mysoplex->removeRowRange(nb_rows, nb_lp_rows-1);
+		nb_lp_rows = nb_rows;
+	}
+}
+
 LinearSolver::Status_Sol LinearSolver::solve() {
 
 	soplex::SPxSolver::Status stat = soplex::SPxSolver::UNKNOWN;
 	LinearSolver::Status_Sol res= UNKNOWN;
 
 	try{
+		removeUnusedRows();
 	    stat = mysoplex->solve();
 		if (stat==soplex::SPxSolver::OPTIMAL) {
 		  obj_value = mysoplex->objValue();
@@ -287,10 +296,7 @@ void LinearSolver::cleanConst() {
 		dual_solution=NULL;
 		status_prim = soplex::SPxSolver::UNKNOWN;
 		status_dual = soplex::SPxSolver::UNKNOWN;
-		int status=0;
-		if ((nb_vars)<=  (nb_rows - 1))  {
-			mysoplex->removeRowRange(nb_vars, nb_rows-1);
-		}
+		// the rows are not removed (see addConstraint)
 		nb_rows = nb_vars;
 		obj_value = POS_INFINITY;
 	}
@@ -307,8 +313,9 @@ void LinearSolver::cleanAll() {
 		dual_solution=NULL;
 		status_prim = soplex::SPxSolver::UNKNOWN;
 		status_dual = soplex::SPxSolver::UNKNOWN;
-		mysoplex->removeRowRange(0, nb_rows-1);
+		mysoplex->removeRowRange(0, nb_lp_rows-1);
 		nb_rows = 0;
+		nb_lp_rows = 0;
 		obj_value = POS_INFINITY;
 	}
 	catch(soplex::SPxException& ) {
@@ -419,17 +426,25 @@ void LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign, double rhs) {
 			row1.add(i, row[i]);
 		}
 
+		soplex::LPRow lprow;
 		if (sign==LEQ || sign==LT) {
-			mysoplex->addRow(soplex::LPRow(-soplex::infinity, row1, rhs));
-			nb_rows++;
+			lprow = soplex::LPRow(-soplex::infinity, row1, rhs);
 		}
 		else if (sign==GEQ || sign==GT) {
-			mysoplex->addRow(soplex::LPRow(rhs, row1, soplex::infinity));
-			nb_rows++;
+			lprow = soplex::LPRow(rhs, row1, soplex::infinity);
 		}
 		else
 			throw LPException();
 
+		if (nb_rows<nb_lp_rows) {
+			// overwrite a row of the previous LP (keeps the basis)
+			mysoplex->changeRow(nb_rows, lprow);
+		} else {
+			mysoplex->addRow(lprow);
+			nb_lp_rows++;
+		}
+		nb_rows++;
+
 	}
 	catch(soplex::SPxException& ) {
 		throw LPException();
@@ -2025,94 +2040,276 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifdef _IBEX_WITH_NOLP_
 
+// Built-in simplex (see DualSimplex).
+// The first nb_vars rows of the LP are the bounds of the variables
+// of the simplex, the other rows are the constraints of the simplex.
 
+LinearSolver::LinearSolver(int nb_vars1, int nb_ctr, int max_iter, int max_time_out, double eps) :
+			nb_ctrs(nb_ctr), nb_vars(nb_vars1), nb_rows(nb_vars1), nb_lp_rows(nb_vars1), obj_value(0.0), epsilon(eps),
+			primal_solution(new double[nb_vars1]), dual_solution(NULL),
+			status_prim(0), status_dual(0), mysimplex(new DualSimplex(nb_vars1)),
+			max_iter(max_iter), max_time_out(max_time_out), sense_coef(1.0), obj_coef(new double[nb_vars1]) {
 
-LinearSolver::LinearSolver(int nb_vars, int nb_ctr, int max_iter,
-	int max_time_out, double eps):
-	nb_ctrs(0), nb_vars(0), nb_rows(0), obj_value(0.0), epsilon(0),
-	primal_solution(NULL), dual_solution(NULL),
-	status_prim(0), status_dual(0)
-{
-	ibex_warning("No Linear Solver available.");
+	for (int j=0; j<nb_vars; j++)
+		obj_coef[j]=0.0;
 }
 
 LinearSolver::~LinearSolver() {
+	if (primal_solution) delete [] primal_solution;
+	if (dual_solution) delete [] dual_solution;
+	delete mysimplex;
+	delete [] obj_coef;
+}
+
+void LinearSolver::removeUnusedRows() {
+	if (nb_lp_rows>nb_rows) {
+		mysimplex->remove_rows(nb_rows - nb_vars);
+		nb_lp_rows = nb_rows;
+	}
 }
 
 LinearSolver::Status_Sol LinearSolver::solve() {
-	return LinearSolver::UNKNOWN;
+
+	LinearSolver::Status_Sol res= UNKNOWN;
+
+	removeUnusedRows();
+
+	DualSimplex::Status stat = mysimplex->solve(max_iter, max_time_out, epsilon);
+
+	switch (stat) {
+	case DualSimplex::OPTIMAL:
+	{
+		obj_value = sense_coef*mysimplex->obj_value();
+
+		// the primal solution : used by choose_next_variable
+		for (int i=0; i< nb_vars ; i++) {
+			primal_solution[i]=mysimplex->primal()[i];
+		}
+		status_prim = 1;
+
+		// the dual solution ; used by Neumaier Shcherbina test
+		// (the dual solution of the bound constraints are the reduced costs)
+		if (dual_solution) delete [] dual_solution;
+		dual_solution = new double[nb_rows];
+
+		for (int i=0; i<nb_rows; i++) {
+			double dual, lhs, rhs;
+			if (i<nb_vars) {
+				dual = mysimplex->reduced_costs()[i];
+				lhs  = mysimplex->lb(i);
+				rhs  = mysimplex->ub(i);
+			} else {
+				dual = mysimplex->dual()[i-nb_vars];
+				lhs  = mysimplex->lhs(i-nb_vars);
+				rhs  = mysimplex->rhs(i-nb_vars);
+			}
+			dual *= sense_coef;
+
+			if 	( ((rhs >=  default_max_bound) && (dual<=0)) ||
+					((lhs <= -default_max_bound) && (dual>=0))   ) {
+				dual_solution[i]=0;
+			}
+			else {
+				dual_solution[i]=dual;
+			}
+		}
+		status_dual = 1;
+		res = OPTIMAL;
+		break;
+	}
+	case DualSimplex::INFEASIBLE:
+		res = INFEASIBLE_NOTPROVED;
+		break;
+	case DualSimplex::MAX_ITER:
+		res = MAX_ITER;
+		break;
+	case DualSimplex::TIME_OUT:
+		res = TIME_OUT;
+		break;
+	default:
+		res = UNKNOWN;
+	}
+
+	return res;
 }
 
 void LinearSolver::writeFile(const char* name) {
-	throw LPException();
+	// CPLEX LP format
+	FILE* fd = fopen(name, "w");
+	if (fd==NULL) throw LPException();
+
+	fprintf(fd, "%s\n obj:", sense_coef>0? "Minimize" : "Maximize");
+	for (int j=0; j<nb_vars; j++)
+		if (obj_coef[j]!=0) fprintf(fd, " %+.17g x%d", obj_coef[j], j);
+	fprintf(fd, "\nSubject To\n");
+
+	for (int i=0; i<nb_rows-nb_vars; i++) {
+		for (int bound=0; bound<2; bound++) {
+			double b = bound==0? mysimplex->lhs(i) : mysimplex->rhs(i);
+			if (bound==0? b<=NEG_INFINITY : b>=POS_INFINITY) continue;
+			fprintf(fd, " c%d_%d:", i, bound);
+			for (int j=0; j<nb_vars; j++)
+				if (mysimplex->row(i)[j]!=0) fprintf(fd, " %+.17g x%d", mysimplex->row(i)[j], j);
+			fprintf(fd, " %s %.17g\n", bound==0? ">=" : "<=", b);
+		}
+	}
+
+	fprintf(fd, "Bounds\n");
+	for (int j=0; j<nb_vars; j++) {
+		if (mysimplex->lb(j)<=NEG_INFINITY && mysimplex->ub(j)>=POS_INFINITY)
+			fprintf(fd, " x%d free\n", j);
+		else {
+			if (mysimplex->lb(j)<=NEG_INFINITY) fprintf(fd, " -inf");
+			else fprintf(fd, " %.17g", mysimplex->lb(j));
+			fprintf(fd, " <= x%d <=", j);
+			if (mysimplex->ub(j)>=POS_INFINITY) fprintf(fd, " +inf\n");
+			else fprintf(fd, " %.17g\n", mysimplex->ub(j));
+		}
+	}
+	fprintf(fd, "End\n");
+	fclose(fd);
 }
 
-void LinearSolver::getCoefConstraint(Matrix& A) {
-	throw LPException();
+void LinearSolver::getCoefConstraint(Matrix &A) {
+	A = Matrix::zeros(nb_rows,nb_vars);
+	for (int j=0; j<nb_vars; j++)
+		A[j][j]=1.0;
+	for (int i=nb_vars; i<nb_rows; i++)
+		for (int j=0; j<nb_vars; j++)
+			A[i][j]=mysimplex->row(i-nb_vars)[j];
 }
 
-void LinearSolver::getCoefConstraint_trans(Matrix& A_trans) {
-	throw LPException();
+void LinearSolver::getCoefConstraint_trans(Matrix &A_trans) {
+	A_trans = Matrix::zeros(nb_vars,nb_rows);
+	for (int j=0; j<nb_vars; j++)
+		A_trans[j][j]=1.0;
+	for (int i=nb_vars; i<nb_rows; i++)
+		for (int j=0; j<nb_vars; j++)
+			A_trans[j][i]=mysimplex->row(i-nb_vars)[j];
 }
 
 void LinearSolver::getB(IntervalVector& B) {
-	throw LPException();
+	// Get the bounds of the variables
+	for (int i=0; i<nb_vars; i++) {
+		B[i]=Interval( mysimplex->lb(i), mysimplex->ub(i) );
+	}
+
+	// Get the bounds of the constraints
+	for (int i=nb_vars; i<nb_rows; i++) {
+		double lhs = mysimplex->lhs(i-nb_vars);
+		double rhs = mysimplex->rhs(i-nb_vars);
+		B[i]=Interval( 	(lhs>-default_max_bound)? lhs:-default_max_bound,
+						(rhs< default_max_bound)? rhs: default_max_bound   );
+	}
 }
 
-void LinearSolver::getPrimalSol(Vector& prim) {
-	throw LPException();
+void LinearSolver::getPrimalSol(Vector& solution_primal) {
+	if (status_prim == 1) {
+		for (int i=0; i< nb_vars ; i++) {
+			solution_primal[i] = primal_solution[i];
+		}
+	}
 }
 
-void LinearSolver::getDualSol(Vector& dual) {
-	throw LPException();
+void LinearSolver::getDualSol(Vector& solution_dual) {
+	if (status_dual == 1) {
+		for (int i=0; i<nb_rows; i++) {
+			solution_dual[i] = dual_solution[i];
+		}
+	}
 }
 
 void LinearSolver::getInfeasibleDir(Vector& sol) {
-	throw LPException();
+	const double* farkas = mysimplex->farkas();
+	if (farkas==NULL) throw LPException();
+
+	// the certificate only involves the constraints
+	for (int i=0; i<nb_vars; i++)
+		sol[i]=0.0;
+	for (int i=nb_vars; i<nb_rows; i++)
+		sol[i]=farkas[i-nb_vars];
 }
 
 void LinearSolver::cleanConst() {
-	throw LPException();
+	if (dual_solution) delete[] dual_solution;
+	dual_solution=NULL;
+	status_prim = 0;
+	status_dual = 0;
+	// the rows are not removed (see addConstraint)
+	nb_rows = nb_vars;
+	obj_value = POS_INFINITY;
 }
 
 void LinearSolver::cleanAll() {
-	throw LPException();
+	// note: the bounds of the variables cannot be removed; they are relaxed.
+	cleanConst();
+	removeUnusedRows();
+	for (int j=0; j<nb_vars; j++)
+		mysimplex->set_bounds(j, NEG_INFINITY, POS_INFINITY);
 }
 
 void LinearSolver::setMaxIter(int max) {
-	throw LPException();
+	max_iter = max;
 }
 
 void LinearSolver::setMaxTimeOut(int time) {
-	throw LPException();
+	max_time_out = time;
 }
 
 void LinearSolver::setSense(Sense s) {
-	throw LPException();
+	if (s==LinearSolver::MINIMIZE)
+		sense_coef = 1.0;
+	else if (s==LinearSolver::MAXIMIZE)
+		sense_coef = -1.0;
+	else
+		throw LPException();
+
+	for (int j=0; j<nb_vars; j++)
+		mysimplex->set_obj(j, sense_coef*obj_coef[j]);
 }
 
 void LinearSolver::setVarObj(int var, double coef) {
-	throw LPException();
+	obj_coef[var] = coef;
+	mysimplex->set_obj(var, sense_coef*coef);
 }
 
 void LinearSolver::initBoundVar(IntervalVector bounds) {
-	throw LPException();
+	for (int j=0; j<nb_vars; j++) {
+		mysimplex->set_bounds(j, bounds[j].lb(), bounds[j].ub());
+	}
 }
 
 void LinearSolver::setBoundVar(int var, Interval bound) {
-	throw LPException();
+	mysimplex->set_bounds(var, bound.lb(), bound.ub());
 }
 
 void LinearSolver::setEpsilon(double eps) {
-	throw LPException();
+	epsilon = eps;
 }
 
 void LinearSolver::addConstraint(Vector& row, CmpOp sign, double rhs) {
-	throw LPException();
-}
 
+	double lhs1, rhs1;
+	if (sign==LEQ || sign==LT) {
+		lhs1=NEG_INFINITY; rhs1=rhs;
+	}
+	else if (sign==GEQ || sign==GT) {
+		lhs1=rhs; rhs1=POS_INFINITY;
+	}
+	else
+		throw LPException();
+
+	if (nb_rows<nb_lp_rows) {
+		// overwrite a row of the previous LP (keeps the basis)
+		mysimplex->set_row(nb_rows-nb_vars, &(row[0]), lhs1, rhs1);
+	} else {
+		mysimplex->add_row(&(row[0]), lhs1, rhs1);
+		nb_lp_rows++;
+	}
+	nb_rows++;
+}
 
-#endif //
+#endif // END DEF with NOLP
 
 
 
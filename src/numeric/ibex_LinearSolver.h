@@ -40,7 +40,8 @@
 // TODO not finish yet
 #else
 #ifdef _IBEX_WITH_NOLP_
-// nothing
+// no external linear solver: built-in simplex
+#include "ibex_DualSimplex.h"
 #endif
 #endif
 #endif
@@ -59,6 +60,22 @@ private:
 	int nb_vars;
 	int nb_rows;
 
+#if defined(_IBEX_WITH_SOPLEX_) || defined(_IBEX_WITH_NOLP_)
+	/*
+	 * Number of rows actually stored in the LP (>= nb_rows).
+	 * The rows removed by cleanConst() are kept and overwritten by the
+	 * next calls to addConstraint(...), so that the solver restarts from
+	 * the basis of the previous LP (warm start). The remaining ones are
+	 * only removed before solving.
+	 */
+	int nb_lp_rows;
+
+	/*
+	 * Remove the rows beyond nb_rows (see nb_lp_rows).
+	 */
+	void removeUnusedRows();
+#endif
+
 	double obj_value;
 
 	double epsilon;
@@ -95,6 +112,16 @@ private:
 	int * _col1Index;
 #endif
 
+#ifdef _IBEX_WITH_NOLP_
+	// the bounds of the variables (the first nb_vars rows)
+	// are the bounds of the variables of the simplex.
+	DualSimplex *mysimplex;
+	int max_iter;
+	int max_time_out;
+	double sense_coef; // 1 (minimize) or -1 (maximize)
+	double * obj_coef;
+#endif
+
 
 public:
 
@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_Newton.h"
+#include "ibex_Function.h"
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
 #include "ibex_EmptyBoxException.h"
@@ -21,6 +22,7 @@ namespace ibex {
 
 double default_newton_prec=1e-07;
 double default_gauss_seidel_ratio=1e-04;
+double default_sparse_jacobian_ratio=0.1;
 
 
 namespace {
@@ -33,13 +35,85 @@ namespace {
 //	mid = box.mid();
 //	Fmid=f.eval_vector(mid);
 //
+
+/*
+ * Newton iteration with a sparse Jacobian matrix. The matrix is
+ * directly calculated in sparse format, with the structure S.
+ */
+bool _sparse_newton(const Function& f, const SparseIntervalMatrix& S, IntervalVector& box, double prec, double ratio_gauss_seidel) {
+	int n=f.nb_var();
+	int m=f.image_dim();
+	assert(box.size()==n);
+
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(m);
+	bool reducted=false;
+	double gain;
+	y1= box.mid();
+
+	do {
+		// note: the structure may change with the preconditioning (fill-in)
+		// so the matrix is reset to S at each step.
+		SparseIntervalMatrix J(S);
+
+		f.hansen_matrix(box,J);
+
+		if (J.is_empty()) { return false; }
+
+		mid = box.mid();
+
+		Fmid=f.eval_vector(mid);
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		try {
+			precond(J, Fmid);
+
+			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+
+			if (y.is_empty()) { box.set_empty(); throw EmptyBoxException(); }
+		} catch (LinearException& ) {
+			return reducted; // should be false
+		}
+
+		IntervalVector box2=mid-y;
+
+		if ((box2 &= box).is_empty()) { box.set_empty(); throw EmptyBoxException(); }
+
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+
+	}
+	while (gain >= prec);
+	return reducted;
 }
 
-bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
+/*
+ * Newton iteration. If C is NULL, the preconditioner is computed
+ * at each step. Otherwise, C is used for all the steps (and first
+ * computed if "update" is true).
+ */
+bool _newton(const Fnc& f, Matrix* C, bool& update, IntervalVector& box, double prec, double ratio_gauss_seidel, bool mid_rad) {
 	int n=f.nb_var();
 	int m=f.image_dim();
 	assert(box.size()==n);
 
+	// If the structure of the function (the variables of each component)
+	// is sparse enough, the dense Jacobian matrix is not calculated at all.
+	const Function* func=dynamic_cast<const Function*>(&f);
+	if (!C && func && m==n) {
+		SparseIntervalMatrix S=func->jacobian_structure();
+		if (S.density()<default_sparse_jacobian_ratio)
+			return _sparse_newton(*func, S, box, prec, ratio_gauss_seidel);
+	}
+
 	IntervalMatrix J(m, n);
 	IntervalVector y(n);
 	IntervalVector y1(n);
@@ -75,9 +149,25 @@ bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_s
 		y1=y;
 
 		try {
-			precond(J, Fmid);
-
-			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+			if (C) {
+				if (update) {
+					precond_matrix(J, *C);
+					update=false;
+				}
+				if (mid_rad) {
+					J = mul_mid_rad(*C,J);
+					Fmid = mul_mid_rad(*C,Fmid);
+				} else {
+					J = (*C)*J;
+					Fmid = (*C)*Fmid;
+				}
+
+				gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+			} else {
+				precond(J, Fmid, mid_rad);
+
+				gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+			}
 
 			if (y.is_empty()) { box.set_empty(); throw EmptyBoxException(); }
 		} catch (LinearException& ) {
@@ -99,6 +189,19 @@ bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_s
 	return reducted;
 }
 
+} // end anonymous namespace
+
+bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel, bool mid_rad) {
+	bool update=false;
+	return _newton(f, NULL, update, box, prec, ratio_gauss_seidel, mid_rad);
+}
+
+bool newton(const Fnc& f, Matrix& C, bool& update, IntervalVector& box, double prec, double ratio_gauss_seidel, bool mid_rad) {
+	assert(update || (C.nb_rows()==f.image_dim() && C.nb_cols()==f.image_dim()));
+	if (update) C.resize(f.image_dim(),f.image_dim());
+	return _newton(f, &C, update, box, prec, ratio_gauss_seidel, mid_rad);
+}
+
 bool inflating_newton(const Fnc& f, IntervalVector& box, int k_max, double mu_max, double delta, double chi) {
 	int n=f.nb_var();
 	int m=f.image_dim();
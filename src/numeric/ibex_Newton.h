@@ -12,6 +12,7 @@
 #define __IBEX_NEWTON_H__
 
 #include "ibex_Fnc.h"
+#include "ibex_Matrix.h"
 
 namespace ibex {
 
@@ -25,6 +26,15 @@ extern double default_newton_prec;
  */
 extern double default_gauss_seidel_ratio;
 
+/**
+ * \brief Default sparsity threshold
+ *
+ * If the ratio of entries (i,j) such that the ith component of the
+ * function depends on the jth variable is below this threshold, the
+ * Jacobian matrix is calculated and handled in sparse format.
+ */
+extern double default_sparse_jacobian_ratio;
+
 /** \ingroup numeric
  *
  * \brief Multivariate Newton operator (contracting).
@@ -33,6 +43,12 @@ extern double default_gauss_seidel_ratio;
  * It can be used either as a contractor or as an existence test.
  * The underlying linear routine is \link ibex::gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double) Gauss-Seidel \endlink.
  *
+ * If \a f is a #ibex::Function and the structure of its Jacobian matrix is sparse (ratio of
+ * entries less than #default_sparse_jacobian_ratio, see #ibex::Function::jacobian_structure()),
+ * the (Hansen) matrix is directly calculated in sparse format and the sparse variants of the linear
+ * routines are used instead, with a block-diagonal preconditioning
+ * (see #ibex::precond(SparseIntervalMatrix&, IntervalVector&, int)).
+ *
  * \param f - The function
  * \param box - The box
  * \param prec (optional) - Criterion for stopping the main loop of the iteration. If a step of interval Newton does not reduce the
@@ -41,9 +57,29 @@ extern double default_gauss_seidel_ratio;
  * \param gauss_seidel_ratio (optional) - Criterion for stopping the inner Gauss-Seidel loop. If a step of Gauss Seidel does not
  * reduce the variable domain diameter by more than \a ratio_gauss_seidel times, then the linear iteration stops.
  * The default value is #default_gauss_seidel_ratio (1e-04).
+ * \param mid_rad (optional) - Precondition the (dense) Jacobian matrix with midpoint-radius
+ * products (see #ibex::precond(IntervalMatrix&, IntervalVector&, bool)). False by default.
+ * \return True if one variable has been reduced by more than \a prec.
+ */
+bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio, bool mid_rad=false);
+
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator with a fixed preconditioner.
+ *
+ * Same as #newton(const Fnc&, IntervalVector&, double, double) except that all the
+ * steps use the same (dense) preconditioning matrix \a C. The contraction is valid whatever
+ * C is, but it is only effective if C is close to the inverse of the Jacobian matrix. This allows
+ * to reuse the preconditioner of a larger box (e.g., of the parent node in a search tree).
+ *
+ * \param C      - The preconditioning matrix.
+ * \param update - (input/output) If true, the input value of C is ignored and C is set to the
+ *                 preconditioner of the first step (the inverse of the midpoint of the Jacobian matrix,
+ *                 see #ibex::precond(IntervalMatrix&, IntervalVector&)). Then \a update is set to false.
+ *                 It remains true if no preconditioner could be computed (e.g., singular matrix).
  * \return True if one variable has been reduced by more than \a prec.
  */
-bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+bool newton(const Fnc& f, Matrix& C, bool& update, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio, bool mid_rad=false);
 
 /** \ingroup numeric
  *
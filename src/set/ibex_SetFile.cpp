@@ -0,0 +1,373 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFile.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SetFile.h"
+#include <queue>
+#include <cstring>
+#include <cerrno>
+#include <sstream>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// =========== shortcuts ==================
+#define IN         __IBEX_IN__
+#define OUT        __IBEX_OUT__
+#define UNK        __IBEX_UNK__
+// ========================================
+
+namespace ibex {
+
+const char* SetFile::MAGIC="IBEXSET";
+
+const unsigned int SetFile::VERSION=2;
+
+const unsigned int SetFile::BYTE_ORDER_MARK=0x01020304;
+
+namespace {
+
+// size of the magic string (with the final '\0')
+const size_t MAGIC_SIZE=8;
+
+// size of the header
+size_t header_size(unsigned int version, int n) {
+	return MAGIC_SIZE+(version>=2? 2 : 1)*sizeof(unsigned int)+sizeof(int)+(2*n+1)*sizeof(double);
+}
+
+}
+
+SetFile::SetFile(const char* filename) : _bounding_box(1), _eps(0), nodes(NULL), n(0), map_addr(NULL), map_len(0) {
+
+	// ============ header ===============
+	std::ifstream is(filename, ios::in | ios::binary);
+
+	if (!is.is_open()) {
+		std::stringstream s;
+		s << "SetFile: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	char magic[MAGIC_SIZE];
+	unsigned int version;
+	unsigned int mark=BYTE_ORDER_MARK; // version 1: native byte order
+	int dim;
+
+	is.read(magic, MAGIC_SIZE);
+	is.read((char*) &version, sizeof(unsigned int));
+
+	if (is.fail() || strncmp(magic, MAGIC, MAGIC_SIZE)!=0) {
+		std::stringstream s;
+		s << "SetFile: " << filename << " is not an i-set file";
+		ibex_error(s.str().c_str());
+	}
+
+	if (version>=2) is.read((char*) &mark, sizeof(unsigned int));
+
+	if (mark!=BYTE_ORDER_MARK) {
+		std::stringstream s;
+		s << "SetFile: file " << filename << " has been written with another byte order";
+		ibex_error(s.str().c_str());
+	}
+
+	if (version>VERSION) {
+		std::stringstream s;
+		s << "SetFile: version " << version << " of file " << filename << " is not supported";
+		ibex_error(s.str().c_str());
+	}
+
+	is.read((char*) &dim, sizeof(int));
+
+	if (is.fail() || dim<1) {
+		std::stringstream s;
+		s << "SetFile: bad header in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	is.read((char*) &_eps, sizeof(double));
+
+	_bounding_box.resize(dim);
+	for (int i=0; i<dim; i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		_bounding_box[i]=Interval(lb,ub);
+	}
+
+	is.seekg(0, ios::end);
+	size_t size=is.tellg();
+	size_t offset=header_size(version,dim);
+
+	if (is.fail() || size<offset+sizeof(Node) || (size-offset)%sizeof(Node)!=0) {
+		std::stringstream s;
+		s << "SetFile: file " << filename << " is truncated";
+		ibex_error(s.str().c_str());
+	}
+
+	n=(size-offset)/sizeof(Node);
+
+	// ============ nodes ===============
+#ifndef _MSC_VER
+	is.close();
+
+	int fd=open(filename, O_RDONLY);
+
+	if (fd==-1) {
+		std::stringstream s;
+		s << "SetFile: cannot open file " << filename << " (" << strerror(errno) << ")";
+		ibex_error(s.str().c_str());
+	}
+
+	void* addr=mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (addr==MAP_FAILED) {
+		std::stringstream s;
+		s << "SetFile: cannot map file " << filename << " (" << strerror(errno) << ")";
+		ibex_error(s.str().c_str());
+	}
+	map_addr=addr;
+	map_len=size;
+	nodes=(const Node*) (((char*) addr)+offset);
+#else
+	// no memory mapping: the file is read entirely
+	mem.resize(n);
+	is.seekg(offset);
+	is.read((char*) &mem[0], n*sizeof(Node));
+	is.close();
+	nodes=&mem[0];
+#endif
+
+	// ============ check the records ===============
+	// (so that the queries cannot read out of the file)
+	for (unsigned int k=0; k<n; k++) {
+		unsigned int var1=nodes[k].info>>3;
+		if ((nodes[k].info & 7)>__IBEX_IN_TMP__ ||
+				(var1!=0 && (var1>(unsigned int) dim || k<2 || nodes[k].left>=k-1))) {
+			std::stringstream s;
+			s << "SetFile: bad node " << k << " in file " << filename;
+			ibex_error(s.str().c_str());
+		}
+	}
+}
+
+SetFile::~SetFile() {
+#ifndef _MSC_VER
+	if (map_addr) munmap(map_addr, map_len);
+#endif
+}
+
+bool SetFile::is_set_file(const char* filename) {
+	std::ifstream is(filename, ios::in | ios::binary);
+	char magic[MAGIC_SIZE];
+	is.read(magic, MAGIC_SIZE);
+	return !is.fail() && strncmp(magic, MAGIC, MAGIC_SIZE)==0;
+}
+
+BoolInterval SetFile::contains(unsigned int k, const Vector& pt) const {
+	// descend to the leaf
+	while (nodes[k].info>>3) {
+		int var=(nodes[k].info>>3)-1;
+		if (pt[var]<nodes[k].pt)
+			k=nodes[k].left;
+		else if (pt[var]>nodes[k].pt)
+			k=k-1;
+		else {
+			// the point is on the boundary of the two subtrees
+			BoolInterval l=contains(nodes[k].left, pt);
+			BoolInterval r=contains(k-1, pt);
+			return l==r? l : MAYBE;
+		}
+	}
+	NodeType status=(NodeType) (nodes[k].info & 7);
+	return status==IN? YES : (status==OUT? NO : MAYBE);
+}
+
+BoolInterval SetFile::contains(const Vector& pt) const {
+	assert(pt.size()==_bounding_box.size());
+
+	if (!_bounding_box.contains(pt)) return MAYBE;
+
+	return contains(root(), pt);
+}
+
+void SetFile::visit_leaves(unsigned int k, SetNode::leaf_func func, IntervalVector& nodebox) const {
+	if ((nodes[k].info>>3)==0) {
+		NodeType status=(NodeType) (nodes[k].info & 7);
+		func(nodebox, status==IN? YES : (status==OUT? NO : MAYBE));
+	} else {
+		// the box of the children is obtained by modifying the box of the node
+		int var=(nodes[k].info>>3)-1;
+		Interval x=nodebox[var];
+		nodebox[var]=Interval(x.lb(),nodes[k].pt);
+		visit_leaves(nodes[k].left, func, nodebox);
+		nodebox[var]=Interval(nodes[k].pt,x.ub());
+		visit_leaves(k-1, func, nodebox);
+		nodebox[var]=x;
+	}
+}
+
+void SetFile::visit_leaves(SetNode::leaf_func func) const {
+	IntervalVector box(_bounding_box);
+	visit_leaves(root(), func, box);
+}
+
+namespace {
+
+/*
+ * A node with the square of the distance between its box and the point.
+ */
+class NodeAndDist {
+public:
+	NodeAndDist(unsigned int node, const IntervalVector& box, const Vector& pt) : node(node), box(box) {
+		assert(box.size()==pt.size());
+
+		Interval d=Interval::ZERO;
+		for (int i=0; i<pt.size(); i++) {
+			d += sqr(box[i]-pt[i]);
+		}
+		dist=d.lb();
+	}
+
+	/* the closest node has the highest priority */
+	bool operator<(const NodeAndDist& n) const {
+		return dist>n.dist;
+	}
+
+	unsigned int node;
+	IntervalVector box;
+	double dist;
+};
+
+}
+
+double SetFile::dist(const Vector& pt, bool inside) const {
+	std::priority_queue<NodeAndDist> heap;
+
+	heap.push(NodeAndDist(root(),_bounding_box,pt));
+
+	double lb = POS_INFINITY;
+
+	// see SetInterval::dist. The nodes are processed by increasing
+	// distance so the first node found gives the distance.
+	while (!heap.empty() && heap.top().dist<lb) {
+
+		unsigned int k=heap.top().node;
+		IntervalVector box=heap.top().box;
+		double d=heap.top().dist;
+		heap.pop();
+
+		NodeType status=(NodeType) (nodes[k].info & 7);
+
+		if (status==(inside? IN : OUT)) {
+			lb=d;
+		} else if ((nodes[k].info>>3)!=0 && (    (inside && possibly_contains_in(status))
+		                                     || (!inside && possibly_contains_out(status)))) {
+			int var=(nodes[k].info>>3)-1;
+
+			IntervalVector left(box);
+			left[var]=Interval(box[var].lb(),nodes[k].pt);
+			NodeAndDist l(nodes[k].left, left, pt);
+			if (l.dist<=lb) heap.push(l);
+
+			IntervalVector right(box);
+			right[var]=Interval(nodes[k].pt,box[var].ub());
+			NodeAndDist r(k-1, right, pt);
+			if (r.dist<=lb) heap.push(r);
+		}
+	}
+	return ::sqrt(lb);
+}
+
+// ==========================================================================================================
+
+SetFileWriter::SetFileWriter(const char* filename, const IntervalVector& bounding_box, double eps) : n(0) {
+	os.open(filename, ios::out | ios::trunc | ios::binary);
+
+	if (!os.is_open()) {
+		std::stringstream s;
+		s << "SetFileWriter: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	char magic[MAGIC_SIZE];
+	memset(magic, 0, MAGIC_SIZE);
+	strncpy(magic, SetFile::MAGIC, MAGIC_SIZE-1);
+	os.write(magic, MAGIC_SIZE);
+
+	os.write((char*) &SetFile::VERSION, sizeof(unsigned int));
+	os.write((char*) &SetFile::BYTE_ORDER_MARK, sizeof(unsigned int));
+
+	int dim=bounding_box.size();
+	os.write((char*) &dim, sizeof(int));
+
+	os.write((char*) &eps, sizeof(double));
+
+	for (int i=0; i<dim; i++) {
+		double d; // to store double values
+		d=bounding_box[i].lb();
+		os.write((char*) &d,sizeof(double));
+		d=bounding_box[i].ub();
+		os.write((char*) &d,sizeof(double));
+	}
+}
+
+SetFileWriter::~SetFileWriter() {
+	if (os.is_open()) os.close();
+}
+
+void SetFileWriter::write(unsigned int info, unsigned int left, double pt) {
+	SetFile::Node node;
+	memset(&node, 0, sizeof(SetFile::Node)); // no uninitialized padding in the file
+	node.info=info;
+	node.left=left;
+	node.pt=pt;
+	os.write((char*) &node, sizeof(SetFile::Node));
+	n++;
+}
+
+void SetFileWriter::leaf(NodeType s) {
+	write(s, 0, 0);
+	roots.push_back(n-1);
+	status.push_back(s);
+}
+
+void SetFileWriter::bisect(int var, double pt, NodeType s) {
+	if (roots.size()<2)
+		ibex_error("SetFileWriter: a bisection node requires two subtrees");
+
+	// the right subtree is the last node written
+	assert(roots.back()==n-1);
+	unsigned int left=roots[roots.size()-2];
+
+	roots.resize(roots.size()-2);
+	status.resize(status.size()-2);
+
+	write(((var+1)<<3) | s, left, pt);
+	roots.push_back(n-1);
+	status.push_back(s);
+}
+
+void SetFileWriter::close() {
+	if (roots.size()!=1)
+		ibex_error("SetFileWriter: the tree is not complete");
+
+	os.close();
+
+	if (os.fail())
+		ibex_error("SetFileWriter: fail to write");
+}
+
+} // namespace ibex
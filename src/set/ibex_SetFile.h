@@ -0,0 +1,256 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetFile.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SET_FILE_H__
+#define __IBEX_SET_FILE_H__
+
+#include "ibex_SetNode.h"
+#include <fstream>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief File of an i-set.
+ *
+ * File format of #ibex::SetInterval::save() (version 2). All the values
+ * are in the byte order of the machine that has written the file:
+ * <ul>
+ * <li> header: the magic string "IBEXSET" (8 bytes with the final '\0'), the version
+ *      number (unsigned int), the byte order mark (unsigned int, see #BYTE_ORDER_MARK),
+ *      the dimension n (int), eps (double) and the 2n bounds of the bounding box (doubles);
+ * <li> the nodes of the tree in postorder (the children before the parent, so the
+ *      root is the last node), as fixed-size records (see #Node).
+ * </ul>
+ * Files of version 1 have no byte order mark. A file written with another
+ * byte order is rejected.
+ *
+ * The file is memory-mapped and queried in place, without building the tree
+ * in memory. The records are checked once when the file is opened, so that
+ * a truncated or corrupted file is rejected instead of being read out of bounds.
+ *
+ * The file can be written without holding the tree in memory, with #SetFileWriter.
+ */
+class SetFile {
+public:
+
+	/**
+	 * \brief A node of the tree.
+	 *
+	 * Bits 0-2 of info: status of the node.
+	 * Bits 3-31 of info: 0 if the node is a leaf, the bisected variable +1 otherwise.
+	 *
+	 * The right child of the node k is the node k-1 and the left child
+	 * is the node "left" (bisection nodes only).
+	 */
+	struct Node {
+		unsigned int info;
+		unsigned int left;
+		double pt;
+	};
+
+	/**
+	 * \brief Magic string at the beginning of the file.
+	 */
+	static const char* MAGIC;
+
+	/**
+	 * \brief Current version of the file format.
+	 */
+	static const unsigned int VERSION;
+
+	/**
+	 * \brief Byte order mark (0x01020304), written after the version number.
+	 */
+	static const unsigned int BYTE_ORDER_MARK;
+
+	/**
+	 * \brief Map a file.
+	 *
+	 * Exit with an error if the file is not a valid i-set file.
+	 */
+	SetFile(const char* filename);
+
+	/**
+	 * \brief Unmap the file.
+	 */
+	~SetFile();
+
+	/**
+	 * \brief True if the file starts with the magic string (see #MAGIC).
+	 *
+	 * Files in the former format of #ibex::SetInterval::save() have no magic string.
+	 */
+	static bool is_set_file(const char* filename);
+
+	/**
+	 * \brief The bounding box of the i-set.
+	 */
+	const IntervalVector& bounding_box() const;
+
+	/**
+	 * \brief The precision of the i-set.
+	 */
+	double eps() const;
+
+	/**
+	 * \brief Number of nodes.
+	 */
+	unsigned int nb_nodes() const;
+
+	/**
+	 * \brief The root (the last node).
+	 */
+	unsigned int root() const;
+
+	/**
+	 * \brief The kth node.
+	 */
+	const Node& operator[](unsigned int k) const;
+
+	/**
+	 * \brief Membership of a point.
+	 *
+	 * Return YES (resp. NO) if the point is in a leaf IN (resp. OUT), MAYBE otherwise
+	 * (UNK leaf or point outside the bounding box). A point on the boundary of
+	 * several leaves is YES (resp. NO) if all of them are IN (resp. OUT).
+	 */
+	BoolInterval contains(const Vector& pt) const;
+
+	/**
+	 * \brief Distance of the point "pt" wrt the set (if inside is true)
+	 * of the complementary of the set (if inside is false).
+	 *
+	 * \see #ibex::SetInterval::dist(const Vector&, bool) const.
+	 */
+	double dist(const Vector& pt, bool inside) const;
+
+	/**
+	 * \brief Visit the leaves with a callback "func"
+	 */
+	void visit_leaves(SetNode::leaf_func func) const;
+
+protected:
+	BoolInterval contains(unsigned int k, const Vector& pt) const;
+
+	void visit_leaves(unsigned int k, SetNode::leaf_func func, IntervalVector& nodebox) const;
+
+	IntervalVector _bounding_box;
+	double _eps;
+
+	/* the nodes */
+	const Node* nodes;
+	unsigned int n;
+
+	/* mapped memory */
+	void* map_addr;
+	size_t map_len;
+
+	/* the nodes (if the file is not mapped) */
+	std::vector<Node> mem;
+
+private:
+	SetFile(const SetFile&); // forbidden
+};
+
+/**
+ * \ingroup iset
+ * \brief Streaming writer of an i-set file.
+ *
+ * The nodes are written in postorder, one by one: each call to #bisect()
+ * creates a bisection node whose children are the two last subtrees
+ * written. So a tree can be saved while it is computed (with a depth-first
+ * traversal) without holding it in memory: only the roots of the pending
+ * subtrees are stored.
+ *
+ * \see #ibex::SetFile.
+ */
+class SetFileWriter {
+public:
+	/**
+	 * \brief Create the file and write the header.
+	 */
+	SetFileWriter(const char* filename, const IntervalVector& bounding_box, double eps);
+
+	/**
+	 * \brief Close the file (if not already done).
+	 */
+	~SetFileWriter();
+
+	/**
+	 * \brief Write a leaf.
+	 */
+	void leaf(NodeType status);
+
+	/**
+	 * \brief Write a bisection node.
+	 *
+	 * The variable "var" is bisected at point "pt". The left and right subtrees are
+	 * the two last subtrees written. The status of the node is the union of their status.
+	 */
+	void bisect(int var, double pt);
+
+	/**
+	 * \brief Write a bisection node with a given status.
+	 */
+	void bisect(int var, double pt, NodeType status);
+
+	/**
+	 * \brief Close the file.
+	 *
+	 * The whole tree must have been written (exactly one pending subtree).
+	 */
+	void close();
+
+protected:
+	void write(unsigned int info, unsigned int left, double pt);
+
+	std::ofstream os;
+
+	/* the roots of the pending subtrees and their status */
+	std::vector<unsigned int> roots;
+	std::vector<NodeType> status;
+
+	/* number of nodes written */
+	unsigned int n;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const IntervalVector& SetFile::bounding_box() const {
+	return _bounding_box;
+}
+
+inline double SetFile::eps() const {
+	return _eps;
+}
+
+inline unsigned int SetFile::nb_nodes() const {
+	return n;
+}
+
+inline unsigned int SetFile::root() const {
+	return n-1;
+}
+
+inline const SetFile::Node& SetFile::operator[](unsigned int k) const {
+	assert(k<n);
+	return nodes[k];
+}
+
+inline void SetFileWriter::bisect(int var, double pt) {
+	assert(status.size()>=2);
+	bisect(var, pt, status[status.size()-2] | status.back());
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SET_FILE_H__
@@ -10,11 +10,18 @@
 #include "ibex_SetInterval.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_SetFile.h"
 #include "ibex_CellHeap.h"
 #include "ibex_CellStack.h"
 #include <stack>
+#include <vector>
+#include <algorithm>
 #include <fstream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -47,60 +54,201 @@ void SetInterval::contract(Sep& sep) {
 	root->unset_in_tmp();
 }
 
-SetInterval& SetInterval::operator&=(const SetInterval& set) {
+void SetInterval::sync(const Array<Sep>& seps) {
+	try {
+		parallel_rec(seps, false);
+	} catch(NoSet& e) {
+		delete root;
+		root = NULL;
+		throw e;
+	}
+}
+
+void SetInterval::contract(const Array<Sep>& seps) {
 	root->set_in_tmp();
-	root = root->inter(bounding_box, set.root, set.bounding_box, eps);
+	parallel_rec(seps, true);
 	root->unset_in_tmp();
-	return *this;
 }
 
-SetInterval& SetInterval::operator|=(const SetInterval& set) {
-	root = root->union_(bounding_box, set.root, set.bounding_box, eps);
-	return *this;
+namespace {
+
+/*
+ * A subtree: the pointer to the subtree (in the parent node) and its box.
+ */
+class SubTree {
+public:
+	SubTree(SetNode** node, const IntervalVector& box) : node(node), box(box), size(box.max_diam()) { }
+
+	/* the largest subtree has the highest priority */
+	bool operator<(const SubTree& t) const {
+		return size<t.size;
+	}
+
+	SetNode** node;
+	IntervalVector box;
+	double size; // estimation of the size of the subtree
+};
+
+/* the largest subtree first */
+bool larger(const SubTree& t1, const SubTree& t2) {
+	return t2<t1;
 }
 
-void SetInterval::save(const char* filename) {
-	std::stack<SetNode*> s;
+// number of subtrees processed concurrently, per thread
+const int subtrees_per_thread=8;
 
-	s.push(root);
+}
 
-	fstream os;
-	os.open(filename, ios::out | ios::trunc | ios::binary);
+void SetInterval::parallel_rec(const Array<Sep>& seps, bool inter) {
+	assert(seps.size()>0);
 
-	os.write((char*) &eps, sizeof(double));
+	int nb_threads=seps.size();
+#ifdef _OPENMP
+	nb_threads=std::min(nb_threads, omp_get_max_threads());
+#endif
 
-	int n=bounding_box.size();
-	os.write((char*) &n, sizeof(int));
+	Sep& sep=seps[0];
 
-	for (int i=0; i<bounding_box.size(); i++) {
-		double d; // to store double values
-		d=bounding_box[i].lb();
-		os.write((char*) &d,sizeof(double));
-		d=bounding_box[i].ub();
-		os.write((char*) &d,sizeof(double));
-	}
+	// the pending subtrees (a heap, the largest on top)
+	vector<SubTree> pending(1, SubTree(&root, bounding_box));
 
-	while (!s.empty()) {
-		SetNode* node=s.top();
-		s.pop();
+	// the bisection nodes, in the order they are created (a
+	// node before its children), to be merged at the end
+	vector<SetNode**> bisections;
+
+	// top of the tree (sequential): the largest subtree is split
+	// until there are enough subtrees for the threads
+	while (!pending.empty() && (int) pending.size()<subtrees_per_thread*nb_threads) {
+
+		pop_heap(pending.begin(), pending.end());
+		SubTree t=pending.back();
+		pending.pop_back();
+
+		SetNode*& node=*t.node;
+		const IntervalVector& box=t.box;
+
+		// see SetNode::sync(const IntervalVector&, Sep&, double)
+		// and SetNode::inter(const IntervalVector&, Sep&, double)
+		SetNode* other=contract_set(box, sep, eps);
+		if (inter)
+			node = node->inter(box, other, box, eps);
+		else
+			node = node->sync(box, other, box, eps, !node->is_leaf());
+		delete other;
+
+		// see SetLeaf::sync_rec and SetLeaf::inter_rec
 		if (node->is_leaf()) {
-			int no_var=-1; // to store "-1" (means: leaf)
-			os.write((char*) &no_var, sizeof(int));
-			os.write((char*) &node->status, sizeof(NodeType));
+			if (node->status<__IBEX_UNK__ || box.max_diam()<=eps)
+				continue;
+			int var=box.extr_diam_index(false);
+			double pt=box.bisect(var).first[var].ub();
+			assert(box[var].interior_contains(pt));
+			NodeType status=inter? node->status : __IBEX_UNK__;
+			delete node;
+			node = new SetBisect(var, pt, new SetLeaf(status), new SetLeaf(status));
 		}
-		else {
-			SetBisect* b=(SetBisect*) node;
-			os.write((char*) &b->var, sizeof(int));
-			os.write((char*) &b->pt, sizeof(double));
-			s.push(b->right);
-			s.push(b->left);
+
+		SetBisect* b=(SetBisect*) node;
+		pending.push_back(SubTree(&b->left, b->left_box(box)));
+		push_heap(pending.begin(), pending.end());
+		pending.push_back(SubTree(&b->right, b->right_box(box)));
+		push_heap(pending.begin(), pending.end());
+		bisections.push_back(t.node);
+	}
+
+	// subtrees (parallel), the largest first
+	sort(pending.begin(), pending.end(), larger);
+
+	int n=pending.size();
+	bool no_set=false;
+
+#pragma omp parallel for schedule(dynamic) num_threads(nb_threads) if (n>1)
+	for (int i=0; i<n; i++) {
+		int t=0;
+#ifdef _OPENMP
+		t=omp_get_thread_num();
+#endif
+		SetNode*& node=*pending[i].node;
+		try {
+			if (inter)
+				node = node->inter(pending[i].box, seps[t], eps);
+			else
+				node = node->sync(pending[i].box, seps[t], eps);
+		} catch(NoSet&) {
+#pragma omp critical(no_set)
+			no_set=true;
 		}
 	}
-	os.close();
+
+	if (no_set) throw NoSet();
+
+	// status of children may have changed --> try merge
+	// (see SetBisect::sync_rec and SetBisect::inter_rec)
+	// The children are merged before their parent.
+	for (int k=bisections.size()-1; k>=0; k--)
+		*bisections[k] = ((SetBisect*) *bisections[k])->try_merge();
+}
+
+SetInterval& SetInterval::operator&=(const SetInterval& set) {
+	root->set_in_tmp();
+	root = root->inter(bounding_box, set.root, set.bounding_box, eps);
+	root->unset_in_tmp();
+	return *this;
+}
+
+SetInterval& SetInterval::operator|=(const SetInterval& set) {
+	root = root->union_(bounding_box, set.root, set.bounding_box, eps);
+	return *this;
+}
+
+namespace {
+
+// write the subtree "node" in postorder
+void write(SetFileWriter& w, const SetNode* node) {
+	if (node->is_leaf()) {
+		w.leaf(node->status);
+	} else {
+		const SetBisect* b=(const SetBisect*) node;
+		write(w, b->left);
+		write(w, b->right);
+		w.bisect(b->var, b->pt, b->status);
+	}
+}
+
+// build the subtree of the kth node of a file
+SetNode* build(const SetFile& f, unsigned int k) {
+	unsigned int info=f[k].info;
+	if ((info>>3)==0) {
+		return new SetLeaf((NodeType) (info & 7));
+	} else {
+		SetBisect* b=new SetBisect((info>>3)-1, f[k].pt);
+		b->status=(NodeType) (info & 7);
+		b->left=build(f, f[k].left);
+		b->right=build(f, k-1);
+		return b;
+	}
+}
+
+}
+
+void SetInterval::save(const char* filename) {
+	SetFileWriter w(filename, bounding_box, eps);
+	write(w, root);
+	w.close();
 }
 
 void SetInterval::load(const char* filename) {
 
+	if (SetFile::is_set_file(filename)) {
+		SetFile f(filename);
+		eps=f.eps();
+		bounding_box.resize(f.bounding_box().size());
+		bounding_box=f.bounding_box();
+		root=build(f, f.root());
+		return;
+	}
+
+	// former format (no magic string, nodes in preorder)
 	std::ifstream is;
 	is.open(filename, ios::in | ios::binary);
 
@@ -12,6 +12,7 @@
 
 #include "ibex_SetNode.h"
 #include "ibex_Sep.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -41,6 +42,9 @@ public:
 	/**
 	 * \brief Loads a set from a data file.
 	 *
+	 * Files in the former format (before the version number
+	 * was introduced) can also be loaded.
+	 *
 	 * \see #save().
 	 */
 	SetInterval(const char* filename);
@@ -89,8 +93,42 @@ public:
 
 	void contract(Sep& sep);
 
+	/**
+	 * \brief Parallel i-Set synchronization
+	 *
+	 * Same as #sync(Sep&) but the subtrees are processed concurrently.
+	 *
+	 * The top of the tree is processed sequentially: the largest subtree (the
+	 * box with the largest diameter) is split until there are enough subtrees
+	 * (eight per thread). These subtrees are then processed, the largest first,
+	 * by a pool of threads, each thread using its own separator. Finally, the
+	 * nodes at the top are merged (bottom-up).
+	 *
+	 * The subtrees are independent so the resulting tree is exactly the same as
+	 * with #sync(Sep&), whatever the number of threads is.
+	 *
+	 * \param seps - Copies of the separator, one per thread. The copies must not share any data
+	 *               modified by a separation (in particular, they must not be built on
+	 *               the same functions).
+	 *
+	 * \note The subtrees are only processed concurrently if OpenMP is enabled
+	 * (see the --with-openmp option). Otherwise they are processed one by one.
+	 */
+	void sync(const Array<Sep>& seps);
+
+	/**
+	 * \brief Parallel contraction
+	 *
+	 * Same as #contract(Sep&) but the subtrees are processed concurrently.
+	 *
+	 * \see #sync(const Array<Sep>&).
+	 */
+	void contract(const Array<Sep>& seps);
+
 	/**
 	 * \brief Serialize the set and save it into a file
+	 *
+	 * The file can be queried without being loaded, see #ibex::SetFile.
 	 */
 	void save(const char* filename);
 
@@ -109,8 +147,17 @@ protected:
 	 */
 	void load(const char* filename);
 
+	/**
+	 * \brief Parallel sync (inter=false) or contraction (inter=true)
+	 *
+	 * \see #sync(const Array<Sep>&).
+	 */
+	void parallel_rec(const Array<Sep>& seps, bool inter);
+
 	friend std::ostream& operator<<(std::ostream& os, const SetInterval& set);
 
+	friend class SetIntervalCompact;
+
 	SetNode* root; // NULL means no existing set (warning: different from empty set!)
 
 	double eps;
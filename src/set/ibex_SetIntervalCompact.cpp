@@ -0,0 +1,637 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetIntervalCompact.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SetIntervalCompact.h"
+#include "ibex_SetBisect.h"
+#include "ibex_SetFile.h"
+#include <stack>
+#include <queue>
+#include <fstream>
+
+using namespace std;
+
+// =========== shortcuts ==================
+#define IN         __IBEX_IN__
+#define OUT        __IBEX_OUT__
+#define UNK        __IBEX_UNK__
+#define UNK_IN     __IBEX_UNK_IN__
+#define UNK_OUT    __IBEX_UNK_OUT__
+#define UNK_IN_OUT __IBEX_UNK_IN_OUT__
+#define IN_TMP     __IBEX_IN_TMP__
+// ========================================
+
+namespace ibex {
+
+SetIntervalCompact::SetIntervalCompact(const IntervalVector& bounding_box, double eps, bool inner) :
+		info(1, inner? IN : UNK), children(1), eps(eps), bounding_box(bounding_box) {
+
+}
+
+SetIntervalCompact::SetIntervalCompact(const SetInterval& set) : eps(set.eps), bounding_box(set.bounding_box) {
+	if (set.root) {
+		info.push_back(0);
+		children.push_back(0);
+		copy(0, set.root);
+		compact();
+	}
+}
+
+SetIntervalCompact::SetIntervalCompact(const char* filename) : eps(-1), bounding_box(1) {
+	load(filename);
+}
+
+void SetIntervalCompact::copy(int k, const SetNode* node) {
+	if (node->is_leaf()) {
+		info[k]=node->status;
+	} else {
+		const SetBisect* b=(const SetBisect*) node;
+		set_bisect(k, b->var, b->pt, UNK, UNK);
+		info[k]=((b->var+1)<<3) | b->status;
+		copy(left(k), b->left);
+		copy(right(k), b->right);
+	}
+}
+
+IntervalVector SetIntervalCompact::left_box(int k, const IntervalVector& nodebox) const {
+	IntervalVector leftbox(nodebox);
+	assert(nodebox[var(k)].contains(pt[children[k]]));
+	leftbox[var(k)]=Interval(nodebox[var(k)].lb(),pt[children[k]]);
+	return leftbox;
+}
+
+IntervalVector SetIntervalCompact::right_box(int k, const IntervalVector& nodebox) const {
+	IntervalVector rightbox(nodebox);
+	assert(nodebox[var(k)].contains(pt[children[k]]));
+	rightbox[var(k)]=Interval(pt[children[k]],nodebox[var(k)].ub());
+	return rightbox;
+}
+
+void SetIntervalCompact::set_leaf(int k, NodeType status) {
+	if (!is_leaf(k)) free_children(k);
+	info[k]=status;
+}
+
+void SetIntervalCompact::set_bisect(int k, int var, double x, NodeType left_status, NodeType right_status) {
+	assert(is_leaf(k));
+
+	unsigned int p;
+	if (free_pairs.empty()) {
+		p=pt.size();
+		info.resize(info.size()+2);
+		children.resize(children.size()+2);
+		pt.push_back(x);
+	} else {
+		p=free_pairs.back();
+		free_pairs.pop_back();
+		pt[p]=x;
+	}
+
+	info[2*p+1]=left_status;
+	info[2*p+2]=right_status;
+	children[k]=p;
+	info[k]=((var+1)<<3) | (left_status | right_status);
+}
+
+void SetIntervalCompact::free_children(int k) {
+	if (!is_leaf(left(k))) free_children(left(k));
+	if (!is_leaf(right(k))) free_children(right(k));
+	free_pairs.push_back(children[k]);
+}
+
+void SetIntervalCompact::diff(int k, const IntervalVector& x, const IntervalVector& y, NodeType x_status, NodeType y_status) {
+	assert(is_leaf(k));
+
+	if (y.is_empty()) {
+		info[k]=x_status;
+		return;
+	}
+
+	const int nn=x.size();
+
+	typedef struct {
+		int var;
+		double pt;
+		bool y_left; // is the part that belongs to y on the left (=true) or right (=false) side?
+	} bisection;
+
+	bisection *tmp = new bisection[2*nn]; // in the worst case, there is 2n bisections
+	Interval c1, c2;
+	int b=0;
+
+	// see ibex::diff (ibex_SetNode.cpp)
+	for (int var=0; var<nn; var++) {
+
+		x[var].diff(y[var],c1,c2);
+
+		if (c1.is_empty()) continue;
+
+		if (y_status==UNK && c1.diam()<eps) continue;
+
+		if (x[var]==c1 || (x_status==UNK && x[var].delta(c1)<eps)) {
+			delete[] tmp;
+			info[k]=x_status;
+			return;
+		}
+
+		tmp[b].var = var;
+		if (c1.lb()==x[var].lb()) {
+			tmp[b].pt = c1.ub();
+			tmp[b].y_left = false;
+		} else {
+			tmp[b].pt = c1.lb();
+			tmp[b].y_left = true;
+		}
+		assert(x[var].interior_contains(tmp[b].pt));
+		b++;
+
+		if (c2.is_empty()) continue;
+		if (y_status==UNK && c2.diam()<eps)  continue;
+		if (x[var]==c2 || (x_status==UNK && x[var].delta(c2)<eps)) {
+			delete[] tmp;
+			info[k]=x_status;
+			return;
+		}
+
+		tmp[b].var = var;
+		tmp[b].pt = c2.lb();
+		assert(x[var].interior_contains(tmp[b].pt));
+		tmp[b].y_left = true;
+		b++;
+	}
+
+	// the chain of bisection nodes leading to y
+	int* chain = new int[b+1];
+	chain[0]=k;
+
+	for (int i=0; i<b; i++) {
+		set_bisect(chain[i], tmp[i].var, tmp[i].pt, x_status, x_status);
+		chain[i+1] = tmp[i].y_left? left(chain[i]) : right(chain[i]);
+	}
+	info[chain[b]]=y_status;
+
+	// the status of a bisection node is the one
+	// of its children when it is created
+	for (int i=b-1; i>=0; i--) {
+		int c=chain[i];
+		info[c]=(info[c] & ~7u) | (status(left(c)) | status(right(c)));
+	}
+
+	delete[] chain;
+	delete[] tmp;
+}
+
+void SetIntervalCompact::try_merge(int k) {
+	// the case left=right=UNK may happen.
+	NodeType s=status(left(k));
+	if (s<=UNK && s==status(right(k)))
+		set_leaf(k,s);
+}
+
+void SetIntervalCompact::sync(int k, const IntervalVector& nodebox, Sep& sep) {
+	SetNode* other=contract_set(nodebox, sep, eps);
+	sync(k, nodebox, other, nodebox);
+	delete other;
+	sync_rec(k, nodebox, sep);
+}
+
+void SetIntervalCompact::sync(int k, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox) {
+	if (nodebox.is_disjoint(otherbox))
+		return;
+	else if (other->is_leaf()) {
+		sync(k, nodebox, otherbox, other->status);
+	} else {
+		const SetBisect* b=(const SetBisect*) other;
+		sync(k, nodebox, b->left, b->left_box(otherbox));
+		sync(k, nodebox, b->right, b->right_box(otherbox));
+	}
+}
+
+void SetIntervalCompact::sync(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status) {
+	assert(x_status<=UNK);
+
+	if (is_leaf(k)) {
+		NodeType s=status(k);
+		if (x_status==UNK || s==x_status) {
+			return;
+		} else if (nodebox.is_subset(x)) {
+			if (s!=UNK) throw NoSet();
+			info[k]=x_status;
+		} else if (!(nodebox & x).is_flat()) {
+			diff(k, nodebox, x, s, x_status);
+		}
+	} else {
+		if (x_status==UNK) {
+			return;
+		} else if (nodebox.is_subset(x)) {
+			if (x_status==IN && !possibly_contains_in(status(k))) throw NoSet();
+			if (x_status==OUT && !possibly_contains_out(status(k))) throw NoSet();
+			set_leaf(k, x_status);
+		} else {
+			sync(left(k), left_box(k,nodebox), x, x_status);
+			sync(right(k), right_box(k,nodebox), x, x_status);
+			try_merge(k);
+		}
+	}
+}
+
+void SetIntervalCompact::sync_rec(int k, const IntervalVector& nodebox, Sep& sep) {
+	if (is_leaf(k)) {
+		if (status(k)<UNK || nodebox.max_diam()<=eps)
+			return;
+		int v=nodebox.extr_diam_index(false);
+		double x=nodebox[v].bisect().first.ub();
+		assert(nodebox[v].interior_contains(x));
+		set_bisect(k, v, x, UNK, UNK);
+	}
+	sync(left(k), left_box(k,nodebox), sep);
+	sync(right(k), right_box(k,nodebox), sep);
+	try_merge(k);
+}
+
+void SetIntervalCompact::inter(int k, const IntervalVector& nodebox, Sep& sep) {
+	SetNode* other=contract_set(nodebox, sep, eps);
+	inter(k, nodebox, other, nodebox);
+	delete other;
+	inter_rec(k, nodebox, sep);
+}
+
+void SetIntervalCompact::inter(int k, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox) {
+	if (nodebox.is_disjoint(otherbox))
+		return;
+	else if (other->is_leaf()) {
+		inter(k, nodebox, otherbox, other->status);
+	} else {
+		const SetBisect* b=(const SetBisect*) other;
+		inter(k, nodebox, b->left, b->left_box(otherbox));
+		inter(k, nodebox, b->right, b->right_box(otherbox));
+	}
+}
+
+void SetIntervalCompact::inter(int k, const IntervalVector& nodebox, const SetIntervalCompact& other, int other_k, const IntervalVector& otherbox) {
+	if (nodebox.is_disjoint(otherbox))
+		return;
+	else if (other.is_leaf(other_k)) {
+		inter(k, nodebox, otherbox, other.status(other_k));
+	} else {
+		inter(k, nodebox, other, other.left(other_k), other.left_box(other_k,otherbox));
+		inter(k, nodebox, other, other.right(other_k), other.right_box(other_k,otherbox));
+	}
+}
+
+void SetIntervalCompact::inter(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status) {
+	assert(x_status<=UNK);
+
+	if (is_leaf(k)) {
+		NodeType s=status(k);
+		if (s<UNK || x_status==UNK) {
+			return;
+		} else if (nodebox.is_subset(x)) {
+			if (x_status==IN && s==IN_TMP) info[k]=IN; // if status==UNK, it remains UNK.
+			else if (x_status==OUT) info[k]=OUT;
+		} else if (s!=UNK) {
+			// status=(IN_TMP), xstatus=(IN | OUT).
+			diff(k, nodebox, x, s, x_status==OUT? OUT : IN);
+		}
+	} else {
+		if (x_status==OUT && nodebox.is_subset(x)) {
+			set_leaf(k, x_status);
+		} else {
+			inter(left(k), left_box(k,nodebox), x, x_status);
+			inter(right(k), right_box(k,nodebox), x, x_status);
+			try_merge(k);
+		}
+	}
+}
+
+void SetIntervalCompact::inter_rec(int k, const IntervalVector& nodebox, Sep& sep) {
+	if (is_leaf(k)) {
+		NodeType s=status(k);
+		if (s<UNK || nodebox.max_diam()<=eps)
+			return; // if status is IN_TMP, it stays like this.
+		int v=nodebox.extr_diam_index(false);
+		double x=nodebox[v].bisect().first.ub();
+		assert(nodebox[v].interior_contains(x));
+		set_bisect(k, v, x, s, s);
+	}
+	inter(left(k), left_box(k,nodebox), sep);
+	inter(right(k), right_box(k,nodebox), sep);
+	try_merge(k);
+}
+
+void SetIntervalCompact::union_(int k, const IntervalVector& nodebox, const SetIntervalCompact& other, int other_k, const IntervalVector& otherbox) {
+	if (nodebox.is_disjoint(otherbox))
+		return;
+	else if (other.is_leaf(other_k)) {
+		union_(k, nodebox, otherbox, other.status(other_k));
+	} else {
+		union_(k, nodebox, other, other.left(other_k), other.left_box(other_k,otherbox));
+		union_(k, nodebox, other, other.right(other_k), other.right_box(other_k,otherbox));
+	}
+}
+
+void SetIntervalCompact::union_(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status) {
+	assert(x_status<=UNK);
+
+	if (x_status>IN) return;
+
+	if (is_leaf(k)) {
+		NodeType s=status(k);
+		if (s==IN) {
+			return;
+		} else if (nodebox.is_subset(x)) {
+			info[k]=IN;
+		} else {
+			// status=(UNK | OUT), xstatus=(IN).
+			diff(k, nodebox, x, s, IN);
+		}
+	} else {
+		if (nodebox.is_subset(x)) {
+			set_leaf(k, IN);
+		} else {
+			union_(left(k), left_box(k,nodebox), x, x_status);
+			union_(right(k), right_box(k,nodebox), x, x_status);
+			try_merge(k);
+		}
+	}
+}
+
+void SetIntervalCompact::set_in_tmp() {
+	// recycled nodes are also modified (this is harmless)
+	for (vector<unsigned int>::iterator it=info.begin(); it!=info.end(); it++)
+		if (*it==IN) *it=IN_TMP;
+}
+
+void SetIntervalCompact::unset_in_tmp() {
+	for (vector<unsigned int>::iterator it=info.begin(); it!=info.end(); it++)
+		if (*it==IN_TMP) *it=UNK;
+}
+
+void SetIntervalCompact::compact() {
+	if (info.empty()) return;
+
+	int n=nb_nodes();
+
+	vector<unsigned int> new_info(n);
+	vector<unsigned int> new_children(n);
+	vector<double> new_pt((n-1)/2);
+
+	// old index of each node, in breadth-first order
+	vector<unsigned int> old(n);
+	old[0]=0;
+	new_info[0]=info[0];
+
+	int last=1; // number of nodes already ordered
+	unsigned int p=0;  // number of pairs already ordered
+
+	for (int i=0; i<n; i++) {
+		int k=old[i];
+		if (is_leaf(k)) continue;
+		new_children[i]=p;
+		new_pt[p]=pt[children[k]];
+		p++;
+		old[last]=left(k);
+		new_info[last++]=info[left(k)];
+		old[last]=right(k);
+		new_info[last++]=info[right(k)];
+	}
+	assert(last==n);
+
+	info.swap(new_info);
+	children.swap(new_children);
+	pt.swap(new_pt);
+	vector<unsigned int>().swap(free_pairs);
+}
+
+void SetIntervalCompact::sync(Sep& sep) {
+	try {
+		sync(0, bounding_box, sep);
+		compact();
+	} catch(NoSet& e) {
+		info.clear();
+		children.clear();
+		pt.clear();
+		free_pairs.clear();
+		throw e;
+	}
+}
+
+void SetIntervalCompact::contract(Sep& sep) {
+	set_in_tmp();
+	inter(0, bounding_box, sep);
+	unset_in_tmp();
+	compact();
+}
+
+SetIntervalCompact& SetIntervalCompact::operator&=(const SetIntervalCompact& set) {
+	if (&set==this) return *this;
+
+	set_in_tmp();
+	inter(0, bounding_box, set, 0, set.bounding_box);
+	unset_in_tmp();
+	compact();
+	return *this;
+}
+
+SetIntervalCompact& SetIntervalCompact::operator|=(const SetIntervalCompact& set) {
+	if (&set==this) return *this;
+
+	union_(0, bounding_box, set, 0, set.bounding_box);
+	compact();
+	return *this;
+}
+
+void SetIntervalCompact::write(SetFileWriter& w, int k) const {
+	if (is_leaf(k)) {
+		w.leaf(status(k));
+	} else {
+		write(w, left(k));
+		write(w, right(k));
+		w.bisect(var(k), pt[children[k]], status(k));
+	}
+}
+
+void SetIntervalCompact::save(const char* filename) const {
+	SetFileWriter w(filename, bounding_box, eps);
+	write(w, 0);
+	w.close();
+}
+
+void SetIntervalCompact::copy(int k, const SetFile& f, unsigned int fk) {
+	if ((f[fk].info>>3)==0) {
+		info[k]=f[fk].info;
+	} else {
+		set_bisect(k, (f[fk].info>>3)-1, f[fk].pt, UNK, UNK);
+		info[k]=f[fk].info;
+		copy(left(k), f, f[fk].left);
+		copy(right(k), f, fk-1);
+	}
+}
+
+void SetIntervalCompact::load(const char* filename) {
+
+	info.assign(1,UNK);
+	children.assign(1,0);
+
+	if (SetFile::is_set_file(filename)) {
+		SetFile f(filename);
+		eps=f.eps();
+		bounding_box.resize(f.bounding_box().size());
+		bounding_box=f.bounding_box();
+		copy(0, f, f.root());
+		compact();
+		return;
+	}
+
+	// former format (no magic string, nodes in preorder)
+	std::ifstream is;
+	is.open(filename, ios::in | ios::binary);
+
+	is.read((char*) &eps, sizeof(double));
+
+	unsigned int n;
+	is.read((char*) &n, sizeof(int));
+
+	bounding_box.resize(n);
+
+	for (int i=0; i<bounding_box.size(); i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		bounding_box[i]=Interval(lb,ub);
+	}
+
+	// the nodes are stored in preorder
+	std::stack<int> s;
+	s.push(0);
+
+	int var;
+	double x;
+	NodeType status;
+
+	while (!s.empty()) {
+		int k=s.top();
+		s.pop();
+
+		is.read((char*) &var, sizeof(int));
+
+		if (var==-1) {
+			is.read((char*) &status, sizeof(NodeType));
+			info[k]=status;
+		} else {
+			is.read((char*) &x, sizeof(double));
+			set_bisect(k, var, x, UNK, UNK);
+			s.push(right(k));
+			s.push(left(k));
+		}
+	}
+
+	is.close();
+
+	compact();
+}
+
+void SetIntervalCompact::visit_leaves(int k, SetNode::leaf_func func, IntervalVector& nodebox) const {
+	if (is_leaf(k)) {
+		NodeType s=status(k);
+		func(nodebox, s==IN? YES : (s==OUT? NO : MAYBE));
+	} else {
+		// the box of the children is obtained by modifying the box of the node
+		int v=var(k);
+		Interval x=nodebox[v];
+		nodebox[v]=Interval(x.lb(),pt[children[k]]);
+		visit_leaves(left(k), func, nodebox);
+		nodebox[v]=Interval(pt[children[k]],x.ub());
+		visit_leaves(right(k), func, nodebox);
+		nodebox[v]=x;
+	}
+}
+
+void SetIntervalCompact::visit_leaves(SetNode::leaf_func func) const {
+	IntervalVector box(bounding_box);
+	visit_leaves(0, func, box);
+}
+
+void SetIntervalCompact::print(std::ostream& os, int k, const IntervalVector& nodebox, int shift) const {
+	for (int i=0; i<shift; i++) os << ' ';
+	if (is_leaf(k)) {
+		os  << nodebox << " " << to_string(status(k)) << endl;
+	} else {
+		os << "* " << nodebox << endl;
+		print(os, left(k), left_box(k,nodebox), shift+2);
+		print(os, right(k), right_box(k,nodebox), shift+2);
+	}
+}
+
+std::ostream& operator<<(std::ostream& os, const SetIntervalCompact& set) {
+	set.print(os, 0, set.bounding_box, 0);
+	return os;
+}
+
+namespace {
+
+/*
+ * A node with the square of the distance between its box and the point.
+ */
+class NodeAndDist {
+public:
+	NodeAndDist(int node, const IntervalVector& box, const Vector& pt) : node(node), box(box) {
+		assert(box.size()==pt.size());
+
+		Interval d=Interval::ZERO;
+		for (int i=0; i<pt.size(); i++) {
+			d += sqr(box[i]-pt[i]);
+		}
+		dist=d.lb();
+	}
+
+	/* the closest node has the highest priority */
+	bool operator<(const NodeAndDist& n) const {
+		return dist>n.dist;
+	}
+
+	int node;
+	IntervalVector box;
+	double dist;
+};
+
+}
+
+double SetIntervalCompact::dist(const Vector& pt, bool inside) const {
+	std::priority_queue<NodeAndDist> heap;
+
+	heap.push(NodeAndDist(0,bounding_box,pt));
+
+	double lb = POS_INFINITY;
+
+	// see SetInterval::dist. The nodes are processed by increasing
+	// distance so the first node found gives the distance.
+	while (!heap.empty() && heap.top().dist<lb) {
+
+		int k=heap.top().node;
+		IntervalVector box=heap.top().box;
+		double d=heap.top().dist;
+		heap.pop();
+
+		if (status(k)==(inside? IN : OUT)) {
+			lb=d;
+		} else if (!is_leaf(k) && (    (inside && possibly_contains_in(status(k)))
+		                            || (!inside && possibly_contains_out(status(k))))) {
+
+			NodeAndDist l(left(k), left_box(k,box), pt);
+			if (l.dist<=lb) heap.push(l);
+
+			NodeAndDist r(right(k), right_box(k,box), pt);
+			if (r.dist<=lb) heap.push(r);
+		}
+	}
+	return ::sqrt(lb);
+}
+
+} // namespace ibex
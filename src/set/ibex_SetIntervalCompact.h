@@ -0,0 +1,245 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SetIntervalCompact.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SET_INTERVAL_COMPACT_H__
+#define __IBEX_SET_INTERVAL_COMPACT_H__
+
+#include "ibex_SetInterval.h"
+#include "ibex_SetFile.h"
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief Set Interval (compact representation)
+ *
+ * Same i-set as #ibex::SetInterval with the same operations (and the same results)
+ * but the tree is not made of separately allocated nodes. The nodes are stored
+ * in arrays, in breadth-first order:
+ * <ul>
+ * <li> the status and the bisected variable of a node are packed in a single word;
+ * <li> the two children of a bisection node are stored side by side so that only
+ *      one index is stored per bisection node;
+ * <li> the bisection point is stored in a side array, indexed by the pair of children.
+ * </ul>
+ * A bisection node takes 16 bytes and a leaf 8 bytes, to compare with the 40 and 16
+ * bytes (plus the memory allocator overhead) of #ibex::SetBisect and #ibex::SetLeaf.
+ *
+ * Nodes removed by an operation are recycled during this operation and the arrays are
+ * compacted (and sorted in breadth-first order again) at the end.
+ *
+ * The file format of #save() is the one of #ibex::SetInterval (see #ibex::SetFile), so
+ * that the two representations can be converted into each other.
+ */
+class SetIntervalCompact {
+public:
+
+	/**
+	 * \brief Creates a set interval from a simple box
+	 *
+	 * \see #ibex::SetInterval::SetInterval(const IntervalVector&, double, bool).
+	 */
+	SetIntervalCompact(const IntervalVector& bounding_box, double eps, bool inner=true);
+
+	/**
+	 * \brief Creates the compact representation of a set interval.
+	 */
+	SetIntervalCompact(const SetInterval& set);
+
+	/**
+	 * \brief Loads a set from a data file.
+	 *
+	 * \see #save().
+	 */
+	SetIntervalCompact(const char* filename);
+
+	/**
+	 * \brief i-Set Intersection
+	 *
+	 * \see #ibex::SetInterval::operator&=(const SetInterval&).
+	 */
+	SetIntervalCompact& operator&=(const SetIntervalCompact& set);
+
+	/**
+	 * \brief i-Set Union
+	 *
+	 * \see #ibex::SetInterval::operator|=(const SetInterval&).
+	 */
+	SetIntervalCompact& operator|=(const SetIntervalCompact& set);
+
+	/**
+	 * \brief i-Set synchronization
+	 *
+	 * \see #ibex::SetInterval::sync(Sep&).
+	 */
+	void sync(Sep& sep);
+
+	/**
+	 * \brief True if this i-set is empty
+	 *
+	 * \warning: an empty i-set is different from a i-set containing (and possibly only containing) the empty set.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Intersection with the i-set represented by a Sep.
+	 *
+	 * \see #ibex::SetInterval::contract(Sep&).
+	 */
+	void contract(Sep& sep);
+
+	/**
+	 * \brief Serialize the set and save it into a file
+	 *
+	 * The file can also be loaded by #ibex::SetInterval or mapped by #ibex::SetFile.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Visit the leaves with a callback "func"
+	 */
+	void visit_leaves(SetNode::leaf_func func) const;
+
+	/**
+	 * \brief Distance of the point "pt" wrt the set (if inside is true)
+	 * of the complementary of the set (if inside is false).
+	 */
+	double dist(const Vector& pt, bool inside) const;
+
+	/**
+	 * \brief Number of nodes (leaves and bisection nodes).
+	 */
+	int nb_nodes() const;
+
+protected:
+	/**
+	 * \brief Load the set from a file
+	 */
+	void load(const char* filename);
+
+	friend std::ostream& operator<<(std::ostream& os, const SetIntervalCompact& set);
+
+	/* access to the node k */
+	NodeType status(int k) const;
+	bool is_leaf(int k) const;
+	int var(int k) const;
+	int left(int k) const;
+	int right(int k) const;
+	IntervalVector left_box(int k, const IntervalVector& nodebox) const;
+	IntervalVector right_box(int k, const IntervalVector& nodebox) const;
+
+	/* replace the node k by a leaf */
+	void set_leaf(int k, NodeType status);
+
+	/* replace the leaf k by a bisection node with two leaves */
+	void set_bisect(int k, int var, double pt, NodeType left_status, NodeType right_status);
+
+	/* recycle the nodes below k */
+	void free_children(int k);
+
+	/* copy of a node of a SetInterval (recursive) */
+	void copy(int k, const SetNode* node);
+
+	/* copy of the node fk of a file (recursive) */
+	void copy(int k, const SetFile& f, unsigned int fk);
+
+	/* write the subtree of the node k in postorder */
+	void write(SetFileWriter& w, int k) const;
+
+	/* the functions below are the ones of SetNode, SetLeaf and SetBisect,
+	 * applied on the node k. */
+	void diff(int k, const IntervalVector& x, const IntervalVector& y, NodeType x_status, NodeType y_status);
+	void try_merge(int k);
+
+	void sync(int k, const IntervalVector& nodebox, Sep& sep);
+	void sync(int k, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox);
+	void sync(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status);
+	void sync_rec(int k, const IntervalVector& nodebox, Sep& sep);
+
+	void inter(int k, const IntervalVector& nodebox, Sep& sep);
+	void inter(int k, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox);
+	void inter(int k, const IntervalVector& nodebox, const SetIntervalCompact& other, int other_k, const IntervalVector& otherbox);
+	void inter(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status);
+	void inter_rec(int k, const IntervalVector& nodebox, Sep& sep);
+
+	void union_(int k, const IntervalVector& nodebox, const SetIntervalCompact& other, int other_k, const IntervalVector& otherbox);
+	void union_(int k, const IntervalVector& nodebox, const IntervalVector& x, NodeType x_status);
+
+	void visit_leaves(int k, SetNode::leaf_func func, IntervalVector& nodebox) const;
+	void print(std::ostream& os, int k, const IntervalVector& nodebox, int shift) const;
+
+	void set_in_tmp();
+	void unset_in_tmp();
+
+	/* remove the recycled nodes and sort the nodes in breadth-first order */
+	void compact();
+
+	/*
+	 * The nodes. The root is the node 0 and the two children of
+	 * the pair p are the nodes 2p+1 and 2p+2.
+	 *
+	 * Bits 0-2 of info[k]: status of the node k.
+	 * Bits 3-31 of info[k]: 0 if the node k is a leaf, the bisected
+	 *                       variable +1 otherwise.
+	 *
+	 * An empty array means no existing set (warning: different from empty set!)
+	 */
+	std::vector<unsigned int> info;
+
+	/* The pair of children of each bisection node (undefined for a leaf) */
+	std::vector<unsigned int> children;
+
+	/* The bisection point of the parent of each pair */
+	std::vector<double> pt;
+
+	/* The recycled pairs */
+	std::vector<unsigned int> free_pairs;
+
+	double eps;
+
+	IntervalVector bounding_box;
+};
+
+std::ostream& operator<<(std::ostream& os, const SetIntervalCompact& set);
+
+/*================================== inline implementations ========================================*/
+
+inline bool SetIntervalCompact::is_empty() const {
+	return info.empty();
+}
+
+inline int SetIntervalCompact::nb_nodes() const {
+	return info.size()-2*free_pairs.size();
+}
+
+inline NodeType SetIntervalCompact::status(int k) const {
+	return (NodeType) (info[k] & 7);
+}
+
+inline bool SetIntervalCompact::is_leaf(int k) const {
+	return (info[k]>>3)==0;
+}
+
+inline int SetIntervalCompact::var(int k) const {
+	return (info[k]>>3)-1;
+}
+
+inline int SetIntervalCompact::left(int k) const {
+	return 2*children[k]+1;
+}
+
+inline int SetIntervalCompact::right(int k) const {
+	return 2*children[k]+2;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SET_INTERVAL_COMPACT_H__
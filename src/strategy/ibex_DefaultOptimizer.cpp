@@ -75,11 +75,14 @@ Ctc&  DefaultOptimizer::ctc(System& sys, System& ext_sys, double prec) {
 	// the limits for calling soplex are the default values 1e6 for the derivatives and 1e6 for the domains : no error found with these bounds
 	int index=2;
 	if (sys.nb_ctr > 0) {
+		CtcPolytopeHull* cxn_poly=new CtcPolytopeHull(rec(new LinearRelaxCombo (ext_sys,LinearRelaxCombo::XNEWTON)),
+				CtcPolytopeHull::ALL_BOX);
+		// the bounds are computed in parallel if OpenMP is enabled
+		cxn_poly->parallel=true;
 		ctc_list.set_ref(2,rec(new CtcFixPoint
 				(rec(new CtcCompo(
-						rec(new CtcPolytopeHull(rec(new LinearRelaxCombo (ext_sys,LinearRelaxCombo::XNEWTON)),
-								CtcPolytopeHull::ALL_BOX)),
-								rec(new CtcHC4(ext_sys.ctrs,0.01)))), default_relax_ratio)));
+						rec(cxn_poly),
+						rec(new CtcHC4(ext_sys.ctrs,0.01)))), default_relax_ratio)));
 		index++;
 	}
 	ctc_list.resize(index);
@@ -100,12 +100,8 @@ Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
 	if (niter < 3*n) niter=3*n;
 
 	//====================================
-#ifdef _IBEX_WITH_NOLP_
-	mylp = NULL;
-#else
 	mylp = new LinearSolver(n+1,m,niter );
 	//	cout << "sys " << sys << endl;
-#endif // _IBEX_WITH_NOLP_
 }
 
 Optimizer::~Optimizer() {
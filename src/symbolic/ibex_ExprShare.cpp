@@ -0,0 +1,178 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprShare.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_ExprShare.h"
+#include "ibex_Expr.h"
+#include "ibex_Function.h"
+
+#include <cassert>
+
+namespace ibex {
+
+const ExprNode& ExprShare::copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y) {
+
+	assert(new_x.size()>=old_x.size());
+
+	for (int i=0; i<old_x.size(); i++) {
+		if (!clone.found(old_x[i]))
+			clone.insert(old_x[i],&new_x[i]);
+	}
+
+	visit(y);
+
+	return *clone[y];
+}
+
+bool ExprShare::lookup(const ExprNode& e, const Array<const ExprNode>& args, long param, const Function* func) {
+	key.tag=tag.get(e);
+	key.func=func;
+	key.args.clear();
+	key.args.push_back(param);
+	for (int i=0; i<args.size(); i++)
+		key.args.push_back(args[i].id);
+
+	std::map<Key,const ExprNode*>::const_iterator it=table.find(key);
+	if (it!=table.end()) {
+		clone.insert(e,it->second);
+		return false;
+	} else
+		return true;
+}
+
+void ExprShare::insert(const ExprNode& e, const ExprNode& copy) {
+	clone.insert(e,&copy);
+	table.insert(std::pair<Key,const ExprNode*>(key,&copy));
+}
+
+void ExprShare::visit(const ExprNode& e) {
+	if (!clone.found(e)) {
+		e.acceptVisitor(*this);
+	}
+}
+
+void ExprShare::visit(const ExprIndex& i) {
+	visit(i.expr);
+	Array<const ExprNode> args(*clone[i.expr]);
+	if (lookup(i,args,i.index))
+		insert(i, (*clone[i.expr])[i.index]);
+}
+
+void ExprShare::visit(const ExprSymbol& x) {
+	// all the symbols are already in the map
+	assert(false);
+}
+
+void ExprShare::visit(const ExprConstant& c) {
+	clone.insert(c, &c.copy());
+}
+
+// (useless so far)
+void ExprShare::visit(const ExprNAryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprShare::visit(const ExprLeaf& e) {
+	e.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprShare::visit(const ExprBinaryOp& b) {
+	b.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprShare::visit(const ExprUnaryOp& u) {
+	u.acceptVisitor(*this);
+}
+
+#define LEFT   (*clone[e.left])
+#define RIGHT  (*clone[e.right])
+#define EXPR   (*clone[e.expr])
+
+bool ExprShare::nary(const ExprNAryOp& e, long param, const Function* func) {
+	Array<const ExprNode> args(e.nb_args);
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		args.set_ref(i,*clone[e.arg(i)]);
+	}
+	return lookup(e,args,param,func);
+}
+
+bool ExprShare::binary(const ExprBinaryOp& e) {
+	visit(e.left);
+	visit(e.right);
+	Array<const ExprNode> args(LEFT,RIGHT);
+	return lookup(e,args);
+}
+
+bool ExprShare::unary(const ExprUnaryOp& e, long param) {
+	visit(e.expr);
+	Array<const ExprNode> args(EXPR);
+	return lookup(e,args,param);
+}
+
+void ExprShare::visit(const ExprVector& e) {
+	if (nary(e,e.row_vector())) {
+		Array<const ExprNode> args2(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			args2.set_ref(i,*clone[e.arg(i)]);
+		insert(e, ExprVector::new_(args2,e.row_vector()));
+	}
+}
+
+void ExprShare::visit(const ExprApply& e) {
+	if (nary(e,0,&e.func)) {
+		Array<const ExprNode> args2(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			args2.set_ref(i,*clone[e.arg(i)]);
+		insert(e, ExprApply::new_(e.func, args2));
+	}
+}
+
+void ExprShare::visit(const ExprChi& e) {
+	if (nary(e)) {
+		Array<const ExprNode> args2(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			args2.set_ref(i,*clone[e.arg(i)]);
+		insert(e, ExprChi::new_(args2));
+	}
+}
+
+void ExprShare::visit(const ExprAdd& e)   { if (binary(e)) insert(e, LEFT+RIGHT); }
+void ExprShare::visit(const ExprMul& e)   { if (binary(e)) insert(e, LEFT*RIGHT); }
+void ExprShare::visit(const ExprSub& e)   { if (binary(e)) insert(e, LEFT-RIGHT); }
+void ExprShare::visit(const ExprDiv& e)   { if (binary(e)) insert(e, LEFT/RIGHT); }
+void ExprShare::visit(const ExprMax& e)   { if (binary(e)) insert(e, max(LEFT,RIGHT)); }
+void ExprShare::visit(const ExprMin& e)   { if (binary(e)) insert(e, min(LEFT,RIGHT)); }
+void ExprShare::visit(const ExprAtan2& e) { if (binary(e)) insert(e, atan2(LEFT,RIGHT)); }
+
+void ExprShare::visit(const ExprPower& e) { if (unary(e,e.expon)) insert(e, pow(EXPR,e.expon)); }
+void ExprShare::visit(const ExprMinus& e) { if (unary(e)) insert(e, -EXPR); }
+void ExprShare::visit(const ExprTrans& e) { if (unary(e)) insert(e, transpose(EXPR)); }
+void ExprShare::visit(const ExprSign& e)  { if (unary(e)) insert(e, sign (EXPR)); }
+void ExprShare::visit(const ExprAbs& e)   { if (unary(e)) insert(e, abs  (EXPR)); }
+void ExprShare::visit(const ExprSqr& e)   { if (unary(e)) insert(e, sqr  (EXPR)); }
+void ExprShare::visit(const ExprSqrt& e)  { if (unary(e)) insert(e, sqrt (EXPR)); }
+void ExprShare::visit(const ExprExp& e)   { if (unary(e)) insert(e, exp  (EXPR)); }
+void ExprShare::visit(const ExprLog& e)   { if (unary(e)) insert(e, log  (EXPR)); }
+void ExprShare::visit(const ExprCos& e)   { if (unary(e)) insert(e, cos  (EXPR)); }
+void ExprShare::visit(const ExprSin& e)   { if (unary(e)) insert(e, sin  (EXPR)); }
+void ExprShare::visit(const ExprTan& e)   { if (unary(e)) insert(e, tan  (EXPR)); }
+void ExprShare::visit(const ExprCosh& e)  { if (unary(e)) insert(e, cosh (EXPR)); }
+void ExprShare::visit(const ExprSinh& e)  { if (unary(e)) insert(e, sinh (EXPR)); }
+void ExprShare::visit(const ExprTanh& e)  { if (unary(e)) insert(e, tanh (EXPR)); }
+void ExprShare::visit(const ExprAcos& e)  { if (unary(e)) insert(e, acos (EXPR)); }
+void ExprShare::visit(const ExprAsin& e)  { if (unary(e)) insert(e, asin (EXPR)); }
+void ExprShare::visit(const ExprAtan& e)  { if (unary(e)) insert(e, atan (EXPR)); }
+void ExprShare::visit(const ExprAcosh& e) { if (unary(e)) insert(e, acosh(EXPR)); }
+void ExprShare::visit(const ExprAsinh& e) { if (unary(e)) insert(e, asinh(EXPR)); }
+void ExprShare::visit(const ExprAtanh& e) { if (unary(e)) insert(e, atanh(EXPR)); }
+
+} // end ibex namespace
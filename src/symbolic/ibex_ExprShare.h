@@ -0,0 +1,134 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprShare.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_SHARE_H__
+#define __IBEX_EXPR_SHARE_H__
+
+#include "ibex_ExprVisitor.h"
+#include "ibex_Array.h"
+#include "ibex_NodeMap.h"
+#include "ibex_ExprTag.h"
+
+#include <map>
+#include <vector>
+#include <functional>
+
+namespace ibex {
+
+/**
+ * \brief Duplicate expressions with common subexpressions shared.
+ *
+ * This is a copy (see #ibex::ExprCopy) where two subexpressions that apply
+ * the same operator to the same arguments are represented by the same node.
+ * The table of the created nodes is kept from one call to the next so that
+ * several expressions (e.g., the constraints of a system) copied with the same
+ * instance of ExprShare are merged into a single DAG.
+ *
+ * Constant nodes are not shared.
+ */
+class ExprShare : public virtual ExprVisitor {
+
+public:
+	/**
+	 * \brief Duplicate an expression (with new symbols).
+	 *
+	 * \pre Each symbol in y must belong to "old_x".
+	 *
+	 * Symbols in \a old_x are matched to symbols in \a new_x with respect to their order.
+	 * The subexpressions of the copy are shared with the nodes created by
+	 * previous calls.
+	 */
+	const ExprNode& copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y);
+
+protected:
+	void visit(const ExprNode& e);
+	void visit(const ExprIndex& i);
+	void visit(const ExprNAryOp& e);
+	void visit(const ExprLeaf& e);
+	void visit(const ExprBinaryOp& b);
+	void visit(const ExprUnaryOp& u);
+	void visit(const ExprSymbol& x);
+	void visit(const ExprConstant& c);
+	void visit(const ExprVector& e);
+	void visit(const ExprApply& e);
+	void visit(const ExprChi& e);
+	void visit(const ExprAdd& e);
+	void visit(const ExprMul& e);
+	void visit(const ExprSub& e);
+	void visit(const ExprDiv& e);
+	void visit(const ExprMax& e);
+	void visit(const ExprMin& e);
+	void visit(const ExprAtan2& e);
+	void visit(const ExprMinus& e);
+	void visit(const ExprTrans& e);
+	void visit(const ExprSign& e);
+	void visit(const ExprAbs& e);
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e);
+	void visit(const ExprSqrt& e);
+	void visit(const ExprExp& e);
+	void visit(const ExprLog& e);
+	void visit(const ExprCos& e);
+	void visit(const ExprSin& e);
+	void visit(const ExprTan& e);
+	void visit(const ExprCosh& e);
+	void visit(const ExprSinh& e);
+	void visit(const ExprTanh& e);
+	void visit(const ExprAcos& e);
+	void visit(const ExprAsin& e);
+	void visit(const ExprAtan& e);
+	void visit(const ExprAcosh& e);
+	void visit(const ExprAsinh& e);
+	void visit(const ExprAtanh& e);
+
+	/*
+	 * A node is identified by the type of operator (see #ExprTag),
+	 * the applied function (for ExprApply), an optional parameter
+	 * (index, exponent, etc.) and the ids of its arguments in the copy.
+	 */
+	struct Key {
+		uint32_t tag;
+		const Function* func;
+		std::vector<long> args; // the parameter, then the ids of the arguments
+
+		bool operator<(const Key& k) const {
+			if (tag!=k.tag) return tag<k.tag;
+			if (func!=k.func) return std::less<const Function*>()(func,k.func);
+			return args<k.args;
+		}
+	};
+
+	/*
+	 * Look for the copy of e with the given arguments (and parameter).
+	 * If it already exists, it becomes the clone of e and false is
+	 * returned. Otherwise, the key is stored for the subsequent call to
+	 * insert(...) and true is returned.
+	 */
+	bool lookup(const ExprNode& e, const Array<const ExprNode>& args, long param=0, const Function* func=NULL);
+
+	/*
+	 * Record the node "copy" as the clone of e (and under the key
+	 * of the last lookup).
+	 */
+	void insert(const ExprNode& e, const ExprNode& copy);
+
+	bool unary(const ExprUnaryOp& e, long param=0);
+	bool binary(const ExprBinaryOp& e);
+	bool nary(const ExprNAryOp& e, long param=0, const Function* func=NULL);
+
+	NodeMap<const ExprNode*> clone;
+	std::map<Key,const ExprNode*> table;
+	Key key;
+	ExprTag tag;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_EXPR_SHARE_H__
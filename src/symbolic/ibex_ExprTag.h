@@ -0,0 +1,80 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprTag.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_TAG_H__
+#define __IBEX_EXPR_TAG_H__
+
+#include "ibex_Expr.h"
+
+#include <stdint.h>
+
+namespace ibex {
+
+/**
+ * \brief Tag of the type of a node.
+ *
+ * Each type of node has a fixed tag. Unlike typeid names,
+ * the tags do not depend on the compiler.
+ */
+class ExprTag : public virtual ExprVisitor {
+public:
+	/**
+	 * \brief The tag of e.
+	 */
+	uint32_t get(const ExprNode& e) { e.acceptVisitor(*this); return tag; }
+
+protected:
+	void visit(const ExprNode& e)     { e.acceptVisitor(*this); }
+	void visit(const ExprIndex&)      { tag=1; }
+	void visit(const ExprLeaf&)       { tag=0; }
+	void visit(const ExprNAryOp&)     { tag=0; }
+	void visit(const ExprBinaryOp&)   { tag=0; }
+	void visit(const ExprUnaryOp&)    { tag=0; }
+
+	void visit(const ExprSymbol&)     { tag=2; }
+	void visit(const ExprConstant&)   { tag=3; }
+	void visit(const ExprVector&)     { tag=4; }
+	void visit(const ExprApply&)      { tag=5; }
+	void visit(const ExprChi&)        { tag=6; }
+	void visit(const ExprAdd&)        { tag=7; }
+	void visit(const ExprMul&)        { tag=8; }
+	void visit(const ExprSub&)        { tag=9; }
+	void visit(const ExprDiv&)        { tag=10; }
+	void visit(const ExprMax&)        { tag=11; }
+	void visit(const ExprMin&)        { tag=12; }
+	void visit(const ExprAtan2&)      { tag=13; }
+	void visit(const ExprMinus&)      { tag=14; }
+	void visit(const ExprTrans&)      { tag=15; }
+	void visit(const ExprSign&)       { tag=16; }
+	void visit(const ExprAbs&)        { tag=17; }
+	void visit(const ExprPower&)      { tag=18; }
+	void visit(const ExprSqr&)        { tag=19; }
+	void visit(const ExprSqrt&)       { tag=20; }
+	void visit(const ExprExp&)        { tag=21; }
+	void visit(const ExprLog&)        { tag=22; }
+	void visit(const ExprCos&)        { tag=23; }
+	void visit(const ExprSin&)        { tag=24; }
+	void visit(const ExprTan&)        { tag=25; }
+	void visit(const ExprCosh&)       { tag=26; }
+	void visit(const ExprSinh&)       { tag=27; }
+	void visit(const ExprTanh&)       { tag=28; }
+	void visit(const ExprAcos&)       { tag=29; }
+	void visit(const ExprAsin&)       { tag=30; }
+	void visit(const ExprAtan&)       { tag=31; }
+	void visit(const ExprAcosh&)      { tag=32; }
+	void visit(const ExprAsinh&)      { tag=33; }
+	void visit(const ExprAtanh&)      { tag=34; }
+
+	uint32_t tag;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_EXPR_TAG_H__
@@ -45,6 +45,92 @@ void ArcAgenda::propagate(const HyperGraph& g, const BitSet& m) {
 		if (m[i]) propagate(g,-1,i);
 }
 
+PriorityAgenda::PriorityAgenda(int size) : size(size), nb(0), time(0) {
+	heap  = new int[size];
+	pos   = new int[size];
+	prio  = new double[size];
+	stamp = new unsigned long[size];
+	for (int i=0; i<size; i++) {
+		pos[i]=-1;
+	}
+}
+
+PriorityAgenda::~PriorityAgenda() {
+	delete[] heap;
+	delete[] pos;
+	delete[] prio;
+	delete[] stamp;
+}
+
+void PriorityAgenda::push(int p, double pr) {
+	assert(p>=0 && p<size);
+
+	if (pos[p]==-1) {
+		heap[nb]=p;
+		pos[p]=nb++;
+		prio[p]=pr;
+		stamp[p]=time++;
+	} else {
+		if (pr==0) return;
+		prio[p]+=pr;
+	}
+	sift_up(pos[p]);
+}
+
+void PriorityAgenda::pop(int& p) {
+	if (nb==0) throw EmptyAgendaException();
+
+	p=heap[0];
+	pos[p]=-1;
+	if (--nb>0) {
+		heap[0]=heap[nb];
+		pos[heap[0]]=0;
+		sift_down(0);
+	}
+}
+
+void PriorityAgenda::flush() {
+	for (int i=0; i<nb; i++)
+		pos[heap[i]]=-1;
+	nb=0;
+}
+
+void PriorityAgenda::sift_up(int i) {
+	int p=heap[i];
+	while (i>0) {
+		int parent=(i-1)/2;
+		if (!before(p,heap[parent])) break;
+		heap[i]=heap[parent];
+		pos[heap[i]]=i;
+		i=parent;
+	}
+	heap[i]=p;
+	pos[p]=i;
+}
+
+void PriorityAgenda::sift_down(int i) {
+	int p=heap[i];
+	while (2*i+1<nb) {
+		int child=2*i+1;
+		if (child+1<nb && before(heap[child+1],heap[child])) child++;
+		if (!before(heap[child],p)) break;
+		heap[i]=heap[child];
+		pos[heap[i]]=i;
+		i=child;
+	}
+	heap[i]=p;
+	pos[p]=i;
+}
+
+std::ostream& operator<<(std::ostream& os, const PriorityAgenda& a) {
+	os << "(";
+	for (int i=0; i<a.nb; i++) {
+		if (i>0) os << ' ';
+		os << a.heap[i] << ":" << a.prio[a.heap[i]];
+	}
+	return os << ')';
+}
+
 std::ostream& operator<<(std::ostream& os, const ArcAgenda& a) {
 	if (a.empty()) return os << "(empty)";
 
@@ -92,6 +92,65 @@ class Agenda {
   bool delete_it; // optim info
 };
 
+/**
+ * \ingroup tools
+ * \brief Priority propagation agenda.
+ *
+ * Each element is pushed with a priority (e.g., the expected gain of
+ * a contraction). Pushing an element that is already in the agenda
+ * adds the new priority to the current one. The element with the
+ * highest priority is popped first. Elements with the same priority
+ * are popped in the order they have been pushed (FIFO).
+ *
+ * The agenda is implemented as a binary heap: push and pop are in O(log n).
+ */
+class PriorityAgenda {
+
+ public:
+  /** Create an agenda for the elements 0...size-1. */
+  PriorityAgenda(int size);
+
+  ~PriorityAgenda();
+
+  /** Push p with a priority \a prio (or increase
+   * its priority by \a prio if p is already in the agenda). */
+  void push(int p, double prio=0);
+
+  /** Pop the element with the highest priority. */
+  void pop(int& p);
+
+  /** Remove all the elements. */
+  void flush();
+
+  /** True iff p is in the agenda. */
+  bool contains(int p) const;
+
+  /** True iff the agenda is empty. */
+  bool empty() const;
+
+  friend std::ostream& operator<<(std::ostream& os, const PriorityAgenda& q);
+
+ protected:
+  /* true if p must be popped before q */
+  bool before(int p, int q) const;
+
+  void sift_up(int i);
+
+  void sift_down(int i);
+
+  int size;
+  int nb;              // number of elements in the agenda
+  int *heap;           // the heap (elements)
+  int *pos;            // position in the heap (-1 if not in the agenda)
+  double *prio;        // priorities
+  unsigned long *stamp;// insertion time stamp (for FIFO)
+  unsigned long time;  // current time
+
+ private:
+  PriorityAgenda(const PriorityAgenda&);
+  PriorityAgenda& operator=(const PriorityAgenda&);
+};
+
 /**
  * \ingroup tools
  * \brief Propagation agenda (agenda)
@@ -180,5 +239,19 @@ class ArcAgenda : Agenda {
   friend std::ostream& operator<<(std::ostream& os, const ArcAgenda& q);
 };
 
+/*================================== inline implementations ========================================*/
+
+inline bool PriorityAgenda::contains(int p) const {
+  return pos[p]!=-1;
+}
+
+inline bool PriorityAgenda::empty() const {
+  return nb==0;
+}
+
+inline bool PriorityAgenda::before(int p, int q) const {
+  return prio[p]>prio[q] || (prio[p]==prio[q] && stamp[p]<stamp[q]);
+}
+
 } // namespace ibex
 #endif // __IBEX_AGENDA_H__
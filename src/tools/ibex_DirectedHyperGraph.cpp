@@ -11,9 +11,76 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <cassert>
 
 namespace ibex {
 
+DirectedHyperGraph::DirectedHyperGraph(int nb_var, const std::vector<const BitSet*>& input, const std::vector<const BitSet*>& output) :
+		m(input.size()), n(nb_var) {
+
+	assert(input.size()==output.size());
+
+	build(input, ctr_input_adj, var_output_adj);
+	build(output, ctr_output_adj, var_input_adj);
+}
+
+DirectedHyperGraph::~DirectedHyperGraph() {
+	delete[] ctr_input_adj.start;
+	delete[] ctr_input_adj.index;
+	delete[] ctr_output_adj.start;
+	delete[] ctr_output_adj.index;
+	delete[] var_input_adj.start;
+	delete[] var_input_adj.index;
+	delete[] var_output_adj.start;
+	delete[] var_output_adj.index;
+}
+
+void DirectedHyperGraph::build(const std::vector<const BitSet*>& vars, Adjacency& ctr_adj, Adjacency& var_adj) {
+
+	ctr_adj.start = new int[m+1];
+	var_adj.start = new int[n+1];
+
+	// count the arcs
+	for (int j=0; j<=n; j++) var_adj.start[j]=0;
+
+	ctr_adj.start[0]=0;
+	for (int c=0; c<m; c++) {
+		ctr_adj.start[c+1]=ctr_adj.start[c];
+		if (!vars[c]) continue;
+		for (int j=0; j<n; j++) {
+			if ((*vars[c])[j]) {
+				ctr_adj.start[c+1]++;
+				var_adj.start[j+1]++;
+			}
+		}
+	}
+
+	for (int j=0; j<n; j++) var_adj.start[j+1]+=var_adj.start[j];
+
+	int nb_arcs=ctr_adj.start[m];
+	ctr_adj.index = new int[nb_arcs];
+	var_adj.index = new int[nb_arcs];
+
+	// fill the adjacency lists (the constraints are
+	// visited in increasing order so that the lists
+	// of the variables are sorted)
+	int* next = new int[n];
+	for (int j=0; j<n; j++) next[j]=var_adj.start[j];
+
+	for (int c=0; c<m; c++) {
+		if (!vars[c]) continue;
+		int k=ctr_adj.start[c];
+		for (int j=0; j<n; j++) {
+			if ((*vars[c])[j]) {
+				ctr_adj.index[k++]=j;
+				var_adj.index[next[j]++]=c;
+			}
+		}
+	}
+
+	delete[] next;
+}
+
 std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (compressed sparse row representation)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -12,8 +12,10 @@
 #ifndef __IBEX_DIRECTED_HYPER_GRAPH_H__
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
+#include "ibex_BitSet.h"
+
 #include <iostream>
-#include <set>
+#include <vector>
 
 namespace ibex {
 
@@ -21,16 +23,54 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The graph is immutable. The adjacency lists are stored in
+ * compressed sparse row (CSR) format, i.e., in contiguous arrays,
+ * and accessed without copy (see #Range).
  */
 class DirectedHyperGraph {
 public:
+
+	/**
+	 * \brief Read-only view on an adjacency list.
+	 *
+	 * The elements are sorted in increasing order.
+	 */
+	class Range {
+	public:
+		/** \brief First element. */
+		const int* begin() const;
+
+		/** \brief Past-the-end element. */
+		const int* end() const;
+
+		/** \brief Number of elements. */
+		int size() const;
+
+		/** \brief The ith element. */
+		int operator[](int i) const;
+
+	private:
+		friend class DirectedHyperGraph;
+		Range(const int* first, const int* last);
+		const int* first;
+		const int* last;
+	};
+
 	/**
 	 * \brief Build a new directed hyper-graph.
 	 *
+	 * \param nb_var - the number of variables
+	 * \param input  - input[c] is the set of incoming variables of
+	 *                 the constraint c (arcs var->ctr). NULL means "none".
+	 * \param output - output[c] is the set of outgoing variables of
+	 *                 the constraint c (arcs var<-ctr). NULL means "none".
+	 *
+	 * The number of constraints is the size of \a input.
+	 * \pre \a input and \a output have the same size.
 	 */
-	DirectedHyperGraph(int nb_ctr, int nb_var);
+	DirectedHyperGraph(int nb_var, const std::vector<const BitSet*>& input, const std::vector<const BitSet*>& output);
 
-		/**
+	/**
 	 * \brief Delete the graph.
 	 */
 	~DirectedHyperGraph();
@@ -45,40 +85,31 @@ public:
 	 */
 	 int nb_var() const;
 
-	/**
-	 * \brief add an arc betweeen \a ctr and \a var.
-	 *
-	 * \param incoming True iff \a var is an incoming variable
-	 * (the arc is var->ctr). Otherwise, \a var is outgoing (the
-	 * arc is var<-ctr).
-	 */
-	void add_arc(int ctr, int var, bool incoming);
-
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	 Range input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	 Range output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	 Range input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	 Range output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -90,29 +121,48 @@ public:
 private:
 	DirectedHyperGraph(const DirectedHyperGraph&);
 
+	/*
+	 * Adjacency relation in CSR format: the neighbours of the
+	 * node i are index[start[i]],...,index[start[i+1]-1].
+	 */
+	struct Adjacency {
+		int* start;
+		int* index;
+	};
+
+	/* build the adjacency of the constraints and its transpose */
+	void build(const std::vector<const BitSet*>& vars, Adjacency& ctr_adj, Adjacency& var_adj);
+
+	static Range range(const Adjacency& adj, int i);
+
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+	Adjacency ctr_input_adj;
+	Adjacency ctr_output_adj;
+	Adjacency var_input_adj;
+	Adjacency var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
+inline DirectedHyperGraph::Range::Range(const int* first, const int* last) : first(first), last(last) {
+}
+
+inline const int* DirectedHyperGraph::Range::begin() const {
+	return first;
+}
+
+inline const int* DirectedHyperGraph::Range::end() const {
+	return last;
+}
+
+inline int DirectedHyperGraph::Range::size() const {
+	return last-first;
 }
 
-inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
+inline int DirectedHyperGraph::Range::operator[](int i) const {
+	return first[i];
 }
 
 inline int DirectedHyperGraph::nb_ctr() const {
@@ -123,30 +173,24 @@ inline int DirectedHyperGraph::nb_var() const {
 	return n;
 }
 
-inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+inline DirectedHyperGraph::Range DirectedHyperGraph::range(const Adjacency& adj, int i) {
+	return Range(adj.index+adj.start[i], adj.index+adj.start[i+1]);
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
-	return ctr_input_adj[ctr];
+inline DirectedHyperGraph::Range DirectedHyperGraph::input_vars(int ctr) const {
+	return range(ctr_input_adj,ctr);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
-	return ctr_output_adj[ctr];
+inline DirectedHyperGraph::Range DirectedHyperGraph::output_vars(int ctr) const {
+	return range(ctr_output_adj,ctr);
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
-	return var_input_adj[var];
+inline DirectedHyperGraph::Range DirectedHyperGraph::input_ctrs(int var) const {
+	return range(var_input_adj,var);
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
-	return var_output_adj[var];
+inline DirectedHyperGraph::Range DirectedHyperGraph::output_ctrs(int var) const {
+	return range(var_output_adj,var);
 }
 
 } // namespace ibex
@@ -13,28 +13,134 @@
 #include <iostream>
 #include <fcntl.h>
 #include <string>
+#include <cstdio>
+#include <algorithm>
 #include <cerrno>
 #include <stdlib.h>
 #include <cstring>
 #include <assert.h>
 #include <sstream>
 
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
 
 
-const char* PixelMap::FORMAT_VERSION="1.0.0";
+const char* PixelMap::FORMAT_VERSION="2.0.0";
 const char* PixelMap::FF_DATA_IMAGE_ND="DATA_IMD_ND";
 
-PixelMap::PixelMap(unsigned int ndim) : ndim(ndim), zero(0) {
+namespace {
+
+// alignment of the tiles in a file
+const size_t PAGE_SIZE=4096;
+
+}
+
+// ==========================================================================================================
+
+PixelTiles::PixelTiles(unsigned int ndim) : ndim(ndim), bits(ndim==2? 6 : 4), side(1<<bits), ptr(NULL), map_addr(NULL), map_len(0) {
+	for (int d=0; d<3; d++) n[d]=nb_tiles[d]=0;
+}
+
+PixelTiles::~PixelTiles() {
+	clear();
+}
+
+void PixelTiles::clear() {
+#ifndef _MSC_VER
+	if (map_addr) munmap(map_addr, map_len);
+#endif
+	map_addr=NULL;
+	map_len=0;
+	std::vector<DATA_TYPE>().swap(mem);
+	ptr=NULL;
+}
+
+void PixelTiles::resize(const int* grid_size) {
+	clear();
+	for (unsigned int d=0; d<ndim; d++) {
+		n[d]=grid_size[d];
+		nb_tiles[d]=(n[d]+side-1)>>bits;
+	}
+	mem.resize(nb_bytes()/sizeof(DATA_TYPE),0);
+	ptr=&mem[0];
+}
+
+void PixelTiles::map(const int* grid_size, const char* filename, size_t offset, bool shared) {
+	clear();
+	for (unsigned int d=0; d<ndim; d++) {
+		n[d]=grid_size[d];
+		nb_tiles[d]=(n[d]+side-1)>>bits;
+	}
+
+#ifndef _MSC_VER
+	int fd=open(filename, shared? O_RDWR : O_RDONLY);
+	struct stat st;
+	if (fd==-1 || fstat(fd,&st)==-1) {
+		if (fd!=-1) close(fd);
+		std::stringstream s;
+		s << "PixelMap [load]: cannot open file " << filename << " (" << strerror(errno) << ")";
+		ibex_error(s.str().c_str());
+	}
+
+	if ((size_t) st.st_size < offset+nb_bytes()) {
+		close(fd);
+		std::stringstream s;
+		s << "PixelMap [load]: file " << filename << " is truncated";
+		ibex_error(s.str().c_str());
+	}
+
+	// note: a private mapping is "copy on write"
+	map_len=offset+nb_bytes();
+	void* addr=mmap(NULL, map_len, PROT_READ | PROT_WRITE, shared? MAP_SHARED : MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (addr==MAP_FAILED) {
+		map_len=0;
+		std::stringstream s;
+		s << "PixelMap [load]: cannot map file " << filename << " (" << strerror(errno) << ")";
+		ibex_error(s.str().c_str());
+	}
+	map_addr=addr;
+	ptr=(DATA_TYPE*) (((char*) addr)+offset);
+#else
+	// no memory mapping: the file is read entirely
+	if (shared) ibex_error("PixelMap [load]: shared mapping not supported on this platform");
+
+	std::ifstream in_file(filename, ios::in | ios::binary);
+	mem.resize(nb_bytes()/sizeof(DATA_TYPE));
+	ptr=&mem[0];
+	in_file.seekg(offset);
+	in_file.read((char*) ptr, nb_bytes());
+	if (in_file.fail()) {
+		std::stringstream s;
+		s << "PixelMap [load]: file " << filename << " is truncated";
+		ibex_error(s.str().c_str());
+	}
+#endif
+}
+
+void PixelTiles::copy(const PixelTiles& src) {
+	assert(src.size()==size());
+	memcpy(ptr, src.ptr, nb_bytes());
+}
+
+// ==========================================================================================================
+
+PixelMap::PixelMap(unsigned int ndim) : ndim(ndim), data(ndim), zero(0) {
 	leaf_size_ = new double[ndim];
 	origin_ = new double[ndim];
 	grid_size_ = new int[ndim];
 	divb_mul_ = new int[ndim];
 }
 
-PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), zero(0) {
+PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), data(src.ndim), zero(0) {
 	leaf_size_ = new double[ndim];
 	origin_ = new double[ndim];
 	grid_size_ = new int[ndim];
@@ -42,12 +148,12 @@ PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), zero(0) {
 	for(unsigned int i = 0; i < ndim; i++){
 		leaf_size_[i] = src.leaf_size_[i];
 		origin_[i] = src.origin_[i];
-		grid_size_[i] = src.grid_size_[i];	
+		grid_size_[i] = src.grid_size_[i];
 	}
 	init();
 
 	// copy image data
-	data = src.data;
+	data.copy(src.data);
 
 }
 
@@ -58,15 +164,7 @@ PixelMap::~PixelMap() {
 	delete[] divb_mul_;
 }
 
-void PixelMap::init() {
-
-	int size = grid_size_[0];
-	for(unsigned int i=1; i<ndim; i++){
-		size*=grid_size_[i];
-	} 
-	assert(size > 0);
-	data.resize(size);
-	std::fill(data.begin(),data.end(),0);
+void PixelMap::init_offsets() {
 	// Compute offsets
 	divb_mul_[0] = 1;
 	for(unsigned int i=1; i<ndim; i++) {
@@ -75,9 +173,78 @@ void PixelMap::init() {
 	memset(&zero,0,sizeof(DATA_TYPE));
 }
 
+void PixelMap::init() {
+
+	for(unsigned int i=0; i<ndim; i++){
+		assert(grid_size_[i] > 0);
+	}
+	data.resize(grid_size_);
+	init_offsets();
+}
+
+void PixelMap::prefix_sum(unsigned int d) {
+	assert(d<ndim);
+
+	const int side=data.side;
+	// number of pixels in a tile
+	const size_t tile_size=((size_t) 1)<<(ndim*data.bits);
+	// distance between two consecutive slices of a tile along d
+	const size_t s=((size_t) 1)<<(d*data.bits);
+
+	DATA_TYPE* tiles=data.tiles();
+
+	// number of tiles in each dimension
+	size_t nt[3] = { (size_t) data.nb_tiles[0], (size_t) data.nb_tiles[1], ndim==3? (size_t) data.nb_tiles[2] : 1 };
+
+	// distance between two consecutive tiles along d
+	size_t tstride = d==0? 1 : (d==1? nt[0] : nt[0]*nt[1]);
+
+	int nb_columns = (nt[0]*nt[1]*nt[2])/nt[d];
+
+#pragma omp parallel for schedule(dynamic)
+	for (int c=0; c<nb_columns; c++) {
+		// first tile of the column
+		size_t t0 = d==0? c*nt[0] : (d==1? (c%nt[0]) + nt[0]*nt[1]*(c/nt[0]) : c);
+
+		for (size_t l=0; l<nt[d]; l++) {
+			DATA_TYPE* tile=tiles + (t0+l*tstride)*tile_size;
+			// the previous tile in the column
+			DATA_TYPE* prev=l>0? tile - tstride*tile_size : NULL;
+
+			if (d==0) {
+				// sums along the rows of the tile
+				for (size_t r=0; r<tile_size; r+=side) {
+					DATA_TYPE* a=tile+r;
+					if (prev) a[0]+=prev[r+side-1];
+					for (int e=1; e<side; e++) a[e]+=a[e-1];
+				}
+			} else {
+				// the xth slice is made of runs of s contiguous pixels:
+				// base+x*s, ..., base+x*s+s-1 (for each base).
+				for (size_t base=0; base<tile_size; base+=s*side) {
+					DATA_TYPE* a=tile+base;
+					if (prev) {
+						DATA_TYPE* b=prev+base+(side-1)*s;
+						for (size_t e=0; e<s; e++) a[e]+=b[e];
+					}
+					for (int x=1; x<side; x++) {
+						DATA_TYPE* ax=a+x*s;
+						DATA_TYPE* bx=ax-s;
+						for (size_t e=0; e<s; e++) ax[e]+=bx[e];
+					}
+				}
+			}
+		}
+	}
+}
+
 void PixelMap::save(const char *filename) {
+	// The data is written into a temporary file first, since
+	// the data may be mapped from the file to be replaced.
+	std::string tmp_filename=std::string(filename)+".tmp";
+
 	ofstream out_file;
-	out_file.open(filename, ios::out | ios::trunc | ios::binary);
+	out_file.open(tmp_filename.c_str(), ios::out | ios::trunc | ios::binary);
 
 	if(out_file.fail()) {
 		std::stringstream s;
@@ -87,8 +254,12 @@ void PixelMap::save(const char *filename) {
 
 	try {
         write_header(out_file, *this);
+        // the tiles start at a multiple of PAGE_SIZE
+        size_t pos=out_file.tellp();
+        std::string padding((PAGE_SIZE - pos % PAGE_SIZE) % PAGE_SIZE, '\0');
+        out_file << padding;
 		// write data
-		out_file.write((char*)&data[0],data.size()*sizeof(DATA_TYPE));
+		out_file.write((char*) data.tiles(), data.nb_bytes());
 	} catch (std::exception& e) {
 		std::stringstream s;
 		s << "PixelMap [save]: writing error " << e.what() << std::endl;
@@ -96,13 +267,29 @@ void PixelMap::save(const char *filename) {
 	}
 
 	out_file.close();
+
+	if (out_file.fail()) {
+		std::stringstream s;
+		s << "PixelMap [save]: writing error in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+#ifdef _MSC_VER
+	remove(filename);
+#endif
+	if (rename(tmp_filename.c_str(), filename)!=0) {
+		std::stringstream s;
+		s << "PixelMap [save]: cannot rename file " << tmp_filename << " to " << filename;
+		ibex_error(s.str().c_str());
+	}
 }
 
 // read header
-void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
+int PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 
 	std::string line;
 	bool leaf_size_is_set = false, origin_is_set = false, grid_size_is_set  = false;
+	int tile_size = 0;
 
 	// Read the header and fill it in with wonderful values
 	while (!in_file.eof()) {
@@ -146,6 +333,20 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 				s << "does not match the dimension of the array (" << ndim << ")";
 				ibex_error(s.str().c_str());
 			}
+
+			unsigned int elt_size; sstream >> elt_size;
+
+			if (sstream.fail() || elt_size != sizeof(DATA_TYPE)) {
+				in_file.close ();
+				std::stringstream s;
+				if (sstream.fail())
+					s << "PixelMap [read_header]: element size of the file is missing";
+				else {
+					s << "PixelMap [read_header]: element size of the file (" << elt_size << ") ";
+					s << "does not match the size of the elements of the array (" << sizeof(DATA_TYPE) << ")";
+				}
+				ibex_error(s.str().c_str());
+			}
 			continue;
 		}
 
@@ -181,14 +382,19 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 			grid_size_is_set = true;
 			continue;
 		}
+
+		// Only in the tiled format (version>=2.0.0)
+		if (line_type.substr (0, 9) == "TILE_SIZE") {
+			sstream >> tile_size;
+			continue;
+		}
+
 		if (line_type.substr(0,10) == "END_HEADER")
 			break;
 
 	}
 
-	if(leaf_size_is_set && grid_size_is_set && origin_is_set) {
-		output.init();
-	} else {
+	if(!leaf_size_is_set || !grid_size_is_set || !origin_is_set) {
 		std::stringstream s;
 		s << "PixelMap [read_header]: field ";
 		if(!leaf_size_is_set) s << "LEAF_SIZE ";
@@ -198,10 +404,19 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 
 		ibex_error(s.str().c_str());
 	}
+
+	if (tile_size!=0 && tile_size!=output.data.side) {
+		std::stringstream s;
+		s << "PixelMap [read_header]: tile size of the file (" << tile_size << ") ";
+		s << "does not match the tile size of the array (" << output.data.side << ")";
+		ibex_error(s.str().c_str());
+	}
+
+	return tile_size;
 }
 
 
-void PixelMap::load(const char *filename) {
+void PixelMap::load(const char *filename, bool shared) {
 	std::ifstream in_file;
 	in_file.open(filename, ios::in | ios::binary);
 	if(in_file.fail()) {
@@ -212,19 +427,26 @@ void PixelMap::load(const char *filename) {
     }
 
 	try {
-        read_header(in_file, *this);
-		for(unsigned int i = 0; i < data.size(); i++) {
-			DATA_TYPE tmp = 0;
-			in_file.read((char*)&tmp,sizeof(DATA_TYPE));
-			this->data[i] = tmp;
-
+		if (read_header(in_file, *this)==0) {
+			// former format: the pixels are stored line by line
+			init();
+			for(size_t i = 0; i < data.size(); i++) {
+				DATA_TYPE tmp = 0;
+				in_file.read((char*)&tmp,sizeof(DATA_TYPE));
+				this->data[i] = tmp;
+			}
+		} else {
+			size_t pos=in_file.tellg();
+			in_file.close();
+			init_offsets();
+			data.map(grid_size_, filename, ((pos+PAGE_SIZE-1)/PAGE_SIZE)*PAGE_SIZE, shared);
 		}
 	} catch (std::exception& e) {
 		std::stringstream s;
 		s << "PixelMap [load]: reading error " << e.what() << std::endl;
 		ibex_error(s.str().c_str());
 	}
-	in_file.close();
+	if (in_file.is_open()) in_file.close();
 	//    std::cerr  << " read " << output.data.size() << " cubes\n";
 }
 
@@ -237,6 +459,7 @@ void PixelMap::write_header(ofstream& out_file, const PixelMap& input) {
 	oss << "\nLEAF_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.leaf_size_[i];
 	oss << "\nORIGIN";    for(unsigned int i =0; i < ndim;  i++) oss << " " << input.origin_[i];
 	oss << "\nGRID_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.grid_size_[i];
+	oss << "\nTILE_SIZE " << input.data.side;
 	oss << "\nEND_HEADER\n";
 	try {
 		out_file << oss.str();
@@ -266,29 +489,50 @@ void PixelMap2D::set_grid_size(unsigned int ni, unsigned int nj) {
 	init();
 }
 
-// [gch]: Benoit, please check this part of the code
-PixelMap::DATA_TYPE& PixelMap2D::operator()(int i, int j) {
-	unsigned int idx = 0;
-	if (i<0 || j<0) return zero;
+void PixelMap2D::compute_integral_image() {
+	assert(data.size()>0);
 
-	idx = divb_mul_[0]*i  + divb_mul_[1]*j;
+	prefix_sum(0);
+	prefix_sum(1);
+}
 
-	if(idx >= data.size()) {
-		cout << idx << " " << data.size() << " " << i << " " << j << "\n";
-		cout.flush();
-	}
+void PixelMap2D::update_integral_image(int i0, int j0, int ni, int nj, const DATA_TYPE* occupancy) {
+	assert(i0>=0 && j0>=0 && ni>=0 && nj>=0);
+	assert(i0+ni<=grid_size_[0] && j0+nj<=grid_size_[1]);
 
-	assert(idx < data.size());
-	return data.at(idx);
-}
+	if (ni==0 || nj==0) return;
 
-void PixelMap2D::compute_integral_image() {
-	assert(data.size()>0);
+	// variation of each pixel of the sub-rectangle (modulo 2^32)
+	std::vector<DATA_TYPE> delta(ni*nj);
+	for (int b=0; b<nj; b++) {
+		for (int a=0; a<ni; a++) {
+			int i=i0+a;
+			int j=j0+b;
+			DATA_TYPE old = (*this)(i,j) - (*this)(i-1,j) - (*this)(i,j-1) + (*this)(i-1,j-1);
+			delta[a+ni*b] = occupancy[a+ni*b] - old;
+		}
+	}
 
-	for(int i=0; i<grid_size_[0]; i++) {
-		for(int j=0; j<grid_size_[1]; j++) {
-			unsigned int& val = (*this)(i,j);
-			val = (*this)(i-1,j) + (*this)(i,j-1) + (*this)(i,j) - (*this)(i-1,j-1);
+	// integral image of the variations
+	for (int b=0; b<nj; b++)
+		for (int a=1; a<ni; a++) delta[a+ni*b] += delta[a-1+ni*b];
+	for (int b=1; b<nj; b++)
+		for (int a=0; a<ni; a++) delta[a+ni*b] += delta[a+ni*(b-1)];
+
+	const int m=data.side-1;
+
+#pragma omp parallel for schedule(dynamic)
+	for (int j=j0; j<grid_size_[1]; j++) {
+		const DATA_TYPE* d=&delta[ni*std::min(j-j0,nj-1)];
+		const DATA_TYPE last=d[ni-1];
+
+		// the line is made of runs of contiguous pixels (one per tile)
+		for (int i=i0; i<grid_size_[0]; i=(i|m)+1) {
+			DATA_TYPE* p=&data(i,j);
+			int len=std::min((i|m)+1,grid_size_[0])-i;
+			int e=0;
+			for (; e<len && i-i0+e<ni; e++) p[e]+=d[i-i0+e];
+			for (; e<len; e++) p[e]+=last;
 		}
 	}
 }
@@ -318,51 +562,67 @@ void PixelMap3D::set_grid_size(unsigned int ni, unsigned int nj, unsigned int nk
 	init();
 }
 
-// [gch]: Benoit, please check this part of the code
-PixelMap::DATA_TYPE& PixelMap3D::operator()(int i, int j, int k) {
-	unsigned int idx = 0;
-	if (i<0 || j<0 || k<0) return zero;
-
-	idx = divb_mul_[0]*i  + divb_mul_[1]*j + divb_mul_[2]*k;
-
-	assert(idx < data.size());
-	return data.at(idx);
-}
-
 void PixelMap3D::compute_integral_image() {
 	assert(data.size()>0);
 
-	for(int i=0; i<grid_size_[0]; i++) {
-		for(int j=0; j<grid_size_[1]; j++) {
-			for(int k=0; k<grid_size_[2]; k++) {
-				unsigned int& val = (*this)(i,j,k);
-				val = (*this)(i-1,j,k) + (*this)(i,j-1,k) + (*this)(i,j,k-1) + (*this)(i-1, j-1, k-1) + (*this)(i,j,k)
-		            - (*this)(i-1,j,k-1) - (*this)(i,j-1,k-1) - (*this)(i-1,j-1,k);
+	prefix_sum(0);
+	prefix_sum(1);
+	prefix_sum(2);
+}
 
+void PixelMap3D::update_integral_image(int i0, int j0, int k0, int ni, int nj, int nk, const DATA_TYPE* occupancy) {
+	assert(i0>=0 && j0>=0 && k0>=0 && ni>=0 && nj>=0 && nk>=0);
+	assert(i0+ni<=grid_size_[0] && j0+nj<=grid_size_[1] && k0+nk<=grid_size_[2]);
+
+	if (ni==0 || nj==0 || nk==0) return;
+
+	// variation of each pixel of the sub-box (modulo 2^32)
+	std::vector<DATA_TYPE> delta(ni*nj*nk);
+	for (int c=0; c<nk; c++) {
+		for (int b=0; b<nj; b++) {
+			for (int a=0; a<ni; a++) {
+				int i=i0+a;
+				int j=j0+b;
+				int k=k0+c;
+				DATA_TYPE old = (*this)(i,j,k) - (*this)(i-1,j,k) - (*this)(i,j-1,k) - (*this)(i,j,k-1)
+						+ (*this)(i-1,j-1,k) + (*this)(i-1,j,k-1) + (*this)(i,j-1,k-1) - (*this)(i-1,j-1,k-1);
+				delta[a+ni*(b+nj*c)] = occupancy[a+ni*(b+nj*c)] - old;
 			}
 		}
 	}
 
-//  // generic code in PixelMap?
-//	int index[ndim]; // pixel counter (with ndim digits). Starts from (0,0,0) until (n0-1,n1-1,n2-1) with ni=grid_size[i].
-//	for (int d=0; d<ndim-1; d++) {
-//		index[d]=0;
-//	}
-
-//	do {
-//      // compute
-	    // ...
-//		// increment the counter
-//		for (int d=0; d<ndim-1; d++) {
-//			// find the next digit to increment
-//			if (index[d]<grid_size_[d]) { index[d]++; break; }
-//			else index[d]=0; // all the smaller digits are reset to 0.
-//		}
-//
-//
-//	} while (index[ndim-1]!=grid_size_[ndim-1]); // quit the loop when (0,0,0) is reached again.
-
-
+	// integral image of the variations
+	for (int c=0; c<nk; c++)
+		for (int b=0; b<nj; b++)
+			for (int a=1; a<ni; a++) delta[a+ni*(b+nj*c)] += delta[a-1+ni*(b+nj*c)];
+	for (int c=0; c<nk; c++)
+		for (int b=1; b<nj; b++)
+			for (int a=0; a<ni; a++) delta[a+ni*(b+nj*c)] += delta[a+ni*(b-1+nj*c)];
+	for (int c=1; c<nk; c++)
+		for (int b=0; b<nj; b++)
+			for (int a=0; a<ni; a++) delta[a+ni*(b+nj*c)] += delta[a+ni*(b+nj*(c-1))];
+
+	const int m=data.side-1;
+
+	// number of lines (j,k) to be updated
+	int nb_lines=(grid_size_[1]-j0)*(grid_size_[2]-k0);
+
+#pragma omp parallel for schedule(dynamic)
+	for (int l=0; l<nb_lines; l++) {
+		int j=j0+l%(grid_size_[1]-j0);
+		int k=k0+l/(grid_size_[1]-j0);
+		const DATA_TYPE* d=&delta[ni*(std::min(j-j0,nj-1)+nj*std::min(k-k0,nk-1))];
+		const DATA_TYPE last=d[ni-1];
+
+		// the line is made of runs of contiguous pixels (one per tile)
+		for (int i=i0; i<grid_size_[0]; i=(i|m)+1) {
+			DATA_TYPE* p=&data(i,j,k);
+			int len=std::min((i|m)+1,grid_size_[0])-i;
+			int e=0;
+			for (; e<len && i-i0+e<ni; e++) p[e]+=d[i-i0+e];
+			for (; e<len; e++) p[e]+=last;
+		}
+	}
 }
 
 } // namespace ibex
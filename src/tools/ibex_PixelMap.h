@@ -1,5 +1,5 @@
 //============================================================================
-//                                  I B E X                                   
+//                                  I B E X
 // File        : ibex_PixelMap.h
 // Author      : Benoit Desrochers, Gilles Chabert
 // Copyright   : Ecole des Mines de Nantes (France)
@@ -12,14 +12,140 @@
 
 #include <fstream>
 #include <vector>
+#include <cstddef>
+#include <cassert>
 
 namespace ibex {
 
+/**
+ * \brief Tiled array of pixels (2D or 3D).
+ *
+ * The pixels are stored by square (2D) or cubic (3D) tiles of 16KB, so that
+ * neighbouring pixels in any direction are stored in the same memory pages.
+ * Inside a tile and between tiles, the first dimension varies first.
+ * The grid is padded with zeros to a whole number of tiles.
+ *
+ * The tiles are either allocated in memory or mapped from a file.
+ */
+class PixelTiles {
+public:
+	/**
+	 * \brief type of data stored in the grid
+	 */
+	typedef unsigned int DATA_TYPE;
+
+	/**
+	 * \brief Create an empty array of the given dimension (2 or 3).
+	 */
+	PixelTiles(unsigned int ndim);
+
+	/**
+	 * \brief Delete this (unmap the file, if any).
+	 */
+	~PixelTiles();
+
+	/**
+	 * \brief Allocate in memory the tiles of a grid (filled with zeros).
+	 */
+	void resize(const int* grid_size);
+
+	/**
+	 * \brief Map the tiles of a grid from a file.
+	 *
+	 * \param offset - position of the first tile in the file.
+	 * \param shared - if true, the modifications are written into the file.
+	 *                 Otherwise, the file is never modified (copy on write).
+	 */
+	void map(const int* grid_size, const char* filename, size_t offset, bool shared);
+
+	/**
+	 * \brief Copy the pixels of another array (of the same grid size).
+	 */
+	void copy(const PixelTiles& src);
+
+	/**
+	 * \brief Number of pixels (without padding).
+	 */
+	size_t size() const;
+
+	/**
+	 * \brief Size of the tiles in bytes (with padding).
+	 */
+	size_t nb_bytes() const;
+
+	/**
+	 * \brief Pixel of linear index idx.
+	 *
+	 * The first dimension varies first (as in a non-tiled array).
+	 */
+	DATA_TYPE& operator[](size_t idx);
+
+	/**
+	 * \brief Pixel (i,j) of a 2D array (no check).
+	 */
+	DATA_TYPE& operator()(int i, int j);
+
+	/**
+	 * \brief Pixel (i,j,k) of a 3D array (no check).
+	 */
+	DATA_TYPE& operator()(int i, int j, int k);
+
+	/**
+	 * \brief Index of the tile containing the pixel (i,j) or (i,j,k).
+	 *
+	 * The tiles are numbered in the order of storage.
+	 */
+	size_t tile(int i, int j, int k=0) const;
+
+	/**
+	 * \brief The tiles.
+	 */
+	DATA_TYPE* tiles();
+
+	/**
+	 * \brief True if the tiles are mapped from a file.
+	 */
+	bool is_mapped() const;
+
+	/** \brief Either 2 or 3 */
+	const unsigned int ndim;
+
+	/** \brief Log2 of the size of a tile in each dimension. */
+	const int bits;
+
+	/** \brief Size of a tile in each dimension. */
+	const int side;
+
+	/** \brief Number of tiles in each dimension. */
+	int nb_tiles[3];
+
+protected:
+	/* Number of pixels in each dimension. */
+	int n[3];
+
+	/* Unmap the file (or free the memory). */
+	void clear();
+
+	/* The tiles */
+	DATA_TYPE* ptr;
+
+	/* The tiles (if allocated in memory) */
+	std::vector<DATA_TYPE> mem;
+
+	/* The mapping (if mapped from a file) */
+	void* map_addr;
+	size_t map_len;
+
+private:
+	PixelTiles(const PixelTiles&);
+	PixelTiles& operator=(const PixelTiles&);
+};
+
 /**
  * \brief Raster 2D/3D picture image.
  *
  * It stores occupancy grid and integral image.
- * Data is stored in a linear big array.
+ * Data is stored in a tiled array (see #ibex::PixelTiles).
  *
  * with the data, the PixelMap also stores :
  *	- the size of the grid ( leaf_size_)
@@ -48,23 +174,34 @@ public:
 	/**
 	 * \brief type of data stored in the grid
 	 */
-	typedef unsigned int DATA_TYPE;
+	typedef PixelTiles::DATA_TYPE DATA_TYPE;
 
 	/**
-	 * \brief Save the PixelMap into a file given by filename. 
+	 * \brief Save the PixelMap into a file given by filename.
+	 *
+	 * The file is made of a text header followed by the tiles (see #ibex::PixelTiles)
+	 * starting at a multiple of 4096 bytes.
 	 */
     void save(const char* filename);
 
 	/**
-	 * \brief Save the PixelMap from a file given by filename.
+	 * \brief Load the PixelMap from a file given by filename.
+	 *
+	 * A file saved with #save(const char*) is memory-mapped: the tiles are read lazily,
+	 * when they are accessed for the first time, so that the load time does not depend
+	 * on the size of the image. If \a shared is false (default), the file is never
+	 * modified. If \a shared is true, the modifications of the image are written into the file
+	 * (the image can then be larger than the memory, see #compute_integral_image()).
+	 *
+	 * A file in the former format (version 1.0.0, not tiled) is read entirely.
 	 */
-    void load(const char* filename);
+    void load(const char* filename, bool shared=false);
 
 	/**
 	 * \brief Compute the integral image.
 	 *
-	 * The computation is done in place.
-	 *
+	 * The computation is done in place, by prefix sums in each dimension
+	 * (see #prefix_sum(unsigned int)).
 	 */
     virtual void compute_integral_image()=0;
 
@@ -83,14 +220,15 @@ public:
 protected:
 
 	friend class TestPixelMap;
+	friend class CtcPixelMap;
 
 	/**
 	 * \brief return the value of the element idx in the array data
 	 */
-    DATA_TYPE& operator[](int idx);
+    DATA_TYPE& operator[](size_t idx);
 
-    /** \brief Vector storing data. */
-    std::vector<DATA_TYPE> data;
+    /** \brief Tiled array storing data. */
+    PixelTiles data;
 
     /** \brief The division multiplier.
      *
@@ -104,11 +242,22 @@ protected:
     DATA_TYPE zero;
 
     /**
-	 *	\brief Initialize the PixelMap. 
+     * \brief Prefix sums of the pixels along the dth dimension.
+     *
+     * The prefix sums are computed tile by tile, so that only the tiles of one column
+     * of tiles along the dth dimension need to be in memory at a time. The columns of
+     * tiles are processed in parallel if Ibex is compiled with OpenMP (option --with-openmp).
+     * Along the 2nd and 3rd dimensions, the sums involve contiguous rows or planes of pixels
+     * (vectorized by the compiler).
+     */
+    void prefix_sum(unsigned int d);
+
+    /**
+	 *	\brief Initialize the PixelMap.
 	 *		field <leaf_size_> needs to be setted before.
 	 */
 	void init();
-	
+
 	/**
 	 * \brief After setting parameters of the PixelMap( grid_size, leaf_size and origin)
 	 * This function initialiez the array which stores pixel data.
@@ -123,14 +272,21 @@ private:
 	/*
 	 * Read the header from a file.
 	 *  (used by load)
+	 *
+	 * Return the size of the tiles (0 for a file in the former format).
 	 */
-    void read_header(std::ifstream& in_file, PixelMap& output);
+    int read_header(std::ifstream& in_file, PixelMap& output);
 
     /*
      * Write the header in a file.
 	 *  (used by save)
 	 */
     void write_header(std::ofstream& out_file, const PixelMap& input);
+
+    /*
+     * Compute the offsets (divb_mul_).
+     */
+    void init_offsets();
 };
 
 /**
@@ -149,6 +305,23 @@ public:
 
     void set_grid_size(unsigned int ni, unsigned int nj);
 
+    /**
+     * \brief Update the integral image.
+     *
+     * Replace the occupancy of the pixels [i0,i0+ni[ x [j0,j0+nj[ by the given values
+     * and update the integral image accordingly. Only the pixels (i,j) with i>=i0 and
+     * j>=j0 are modified.
+     *
+     * \param occupancy - the ni*nj new values (the first dimension varies first).
+     * \pre the integral image has been computed.
+     */
+    void update_integral_image(int i0, int j0, int ni, int nj, const DATA_TYPE* occupancy);
+
+    /**
+     * \brief The pixel (i,j).
+     *
+     * Return 0 if i<0 or j<0. No other check is done.
+     */
     DATA_TYPE& operator()(int i, int j);
 
 };
@@ -170,14 +343,88 @@ public:
 
 	void set_grid_size(unsigned int ni, unsigned int nj, unsigned int nk);
 
+    /**
+     * \brief Update the integral image.
+     *
+     * Replace the occupancy of the pixels [i0,i0+ni[ x [j0,j0+nj[ x [k0,k0+nk[ by the given values
+     * and update the integral image accordingly. Only the pixels (i,j,k) with i>=i0, j>=j0 and
+     * k>=k0 are modified.
+     *
+     * \param occupancy - the ni*nj*nk new values (the first dimension varies first).
+     * \pre the integral image has been computed.
+     */
+    void update_integral_image(int i0, int j0, int k0, int ni, int nj, int nk, const DATA_TYPE* occupancy);
+
+    /**
+     * \brief The pixel (i,j,k).
+     *
+     * Return 0 if i<0, j<0 or k<0. No other check is done.
+     */
 	DATA_TYPE& operator()(int i, int j, int k);
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline PixelMap::DATA_TYPE& PixelMap::operator[](int idx) {
-	return data.at(idx);
+inline size_t PixelTiles::size() const {
+	size_t s=n[0];
+	for (unsigned int d=1; d<ndim; d++) s*=n[d];
+	return s;
+}
+
+inline size_t PixelTiles::nb_bytes() const {
+	size_t s=sizeof(DATA_TYPE);
+	for (unsigned int d=0; d<ndim; d++) s*=((size_t) nb_tiles[d])<<bits;
+	return s;
+}
+
+inline PixelTiles::DATA_TYPE& PixelTiles::operator()(int i, int j) {
+	const int m=side-1;
+	size_t t=(i>>bits) + ((size_t) nb_tiles[0])*(j>>bits);
+	return ptr[(t<<(2*bits)) | (i&m) | ((j&m)<<bits)];
+}
+
+inline PixelTiles::DATA_TYPE& PixelTiles::operator()(int i, int j, int k) {
+	const int m=side-1;
+	size_t t=(i>>bits) + ((size_t) nb_tiles[0])*((j>>bits) + ((size_t) nb_tiles[1])*(k>>bits));
+	return ptr[(t<<(3*bits)) | (i&m) | ((j&m)<<bits) | ((k&m)<<(2*bits))];
+}
+
+inline PixelTiles::DATA_TYPE& PixelTiles::operator[](size_t idx) {
+	int i=idx % n[0];
+	idx/=n[0];
+	if (ndim==2) return (*this)(i,(int) idx);
+	int j=idx % n[1];
+	return (*this)(i,j,(int) (idx/n[1]));
+}
+
+inline size_t PixelTiles::tile(int i, int j, int k) const {
+	return (i>>bits) + ((size_t) nb_tiles[0])*((j>>bits) + ((size_t) nb_tiles[1])*(k>>bits));
+}
+
+inline PixelTiles::DATA_TYPE* PixelTiles::tiles() {
+	return ptr;
+}
+
+inline bool PixelTiles::is_mapped() const {
+	return map_addr!=NULL;
+}
+
+inline PixelMap::DATA_TYPE& PixelMap::operator[](size_t idx) {
+	assert(idx<data.size());
+	return data[idx];
+}
+
+inline PixelMap::DATA_TYPE& PixelMap2D::operator()(int i, int j) {
+	if (i<0 || j<0) return zero;
+	assert(i<grid_size_[0] && j<grid_size_[1]);
+	return data(i,j);
+}
+
+inline PixelMap::DATA_TYPE& PixelMap3D::operator()(int i, int j, int k) {
+	if (i<0 || j<0 || k<0) return zero;
+	assert(i<grid_size_[0] && j<grid_size_[1] && k<grid_size_[2]);
+	return data(i,j,k);
 }
 
 } // namespace ibex
@@ -37,6 +37,53 @@ void TestAffine2::test02() {
 
 }
 
+void TestAffine2::test_sparse01() {
+	// the sparse and the dense versions of fAF2 must give the same enclosure
+	int n=50;
+	Affine2Main<AF_sfAF2> xs(0.0);
+	Affine2Main<AF_fAF2>  xd(0.0);
+	for (int i=1; i<n; i+=7) {
+		Interval itv(i,i+1);
+		xs += Affine2Main<AF_sfAF2>(n,i,itv)*Affine2Main<AF_sfAF2>(n,i+1,itv);
+		xd += Affine2Main<AF_fAF2>(n,i,itv)*Affine2Main<AF_fAF2>(n,i+1,itv);
+	}
+	xs = sqr(xs)-2*xs;
+	xd = sqr(xd)-2*xd;
+
+	TEST_ASSERT_DELTA(xs.itv().lb(),xd.itv().lb(),1e-8);
+	TEST_ASSERT_DELTA(xs.itv().ub(),xd.itv().ub(),1e-8);
+	for (int i=0; i<=n; i++) {
+		TEST_ASSERT_DELTA(xs.val(i),xd.val(i),1e-8);
+	}
+}
+
+void TestAffine2::test_sparse02() {
+	// condensation of the small terms into the error term
+	int save=AF_sfAF2::max_terms;
+	AF_sfAF2::max_terms=4;
+
+	int n=10;
+	Interval itv(0.0);
+	Affine2Main<AF_sfAF2> x(0.0);
+	for (int i=1; i<=n; i++) {
+		x += Affine2Main<AF_sfAF2>(n,i,Interval(0,i));
+		itv += Interval(0,i);
+	}
+	AF_sfAF2::max_terms=save;
+
+	TEST_ASSERT(itv.is_subset(x.itv()));
+	TEST_ASSERT_DELTA(x.itv().lb(),itv.lb(),1e-8);
+	TEST_ASSERT_DELTA(x.itv().ub(),itv.ub(),1e-8);
+
+	// only the 4 largest terms are kept
+	for (int i=1; i<=n-4; i++) {
+		TEST_ASSERT(x.val(i)==0);
+	}
+	for (int i=n-3; i<=n; i++) {
+		TEST_ASSERT_DELTA(x.val(i),i/2.0,1e-8);
+	}
+}
+
 void TestAffine2::test_pow2() {
 	Variable x;
 	Interval itv;
@@ -35,6 +35,8 @@ public:
 		TEST_ADD(TestAffine2::test_cosh);
 		TEST_ADD(TestAffine2::test_sinh);
 		TEST_ADD(TestAffine2::test_tanh);
+		TEST_ADD(TestAffine2::test_sparse01);
+		TEST_ADD(TestAffine2::test_sparse02);
 
 
 
@@ -68,6 +70,8 @@ public:
 	void test_sinh();
 	void test_tanh();
 
+	void test_sparse01();
+	void test_sparse02();
 
 	void test01();
 	void test02();
@@ -0,0 +1,72 @@
+/* ============================================================================
+ * I B E X - TestAgenda
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestAgenda.h"
+
+using namespace std;
+
+void TestAgenda::fifo01() {
+	PriorityAgenda a(5);
+	a.push(3);
+	a.push(1);
+	a.push(4);
+	a.push(1); // already in
+	int p;
+	a.pop(p); TEST_ASSERT(p==3);
+	a.pop(p); TEST_ASSERT(p==1);
+	a.pop(p); TEST_ASSERT(p==4);
+	TEST_ASSERT(a.empty());
+}
+
+void TestAgenda::priority01() {
+	PriorityAgenda a(5);
+	a.push(0,0.1);
+	a.push(1,0.5);
+	a.push(2,0.2);
+	a.push(3,0.5);
+	int p;
+	a.pop(p); TEST_ASSERT(p==1);
+	a.pop(p); TEST_ASSERT(p==3);
+	a.pop(p); TEST_ASSERT(p==2);
+	a.pop(p); TEST_ASSERT(p==0);
+	TEST_ASSERT(a.empty());
+}
+
+void TestAgenda::priority02() {
+	PriorityAgenda a(5);
+	a.push(0,0.3);
+	a.push(1,0.2);
+	a.push(2,0.1);
+	a.push(2,0.3); // priority of 2 is now 0.4
+	TEST_ASSERT(a.contains(2));
+	TEST_ASSERT(!a.contains(4));
+	int p;
+	a.pop(p); TEST_ASSERT(p==2);
+	TEST_ASSERT(!a.contains(2));
+	a.push(2,0.1);
+	a.pop(p); TEST_ASSERT(p==0);
+	a.pop(p); TEST_ASSERT(p==1);
+	a.pop(p); TEST_ASSERT(p==2);
+	TEST_ASSERT(a.empty());
+}
+
+void TestAgenda::flush01() {
+	PriorityAgenda a(3);
+	a.push(0,1);
+	a.push(2,2);
+	a.flush();
+	TEST_ASSERT(a.empty());
+	TEST_ASSERT(!a.contains(0));
+	a.push(1);
+	int p;
+	a.pop(p); TEST_ASSERT(p==1);
+	TEST_ASSERT(a.empty());
+}
@@ -0,0 +1,36 @@
+/* ============================================================================
+ * I B E X - TestAgenda
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_AGENDA_H__
+#define __TEST_AGENDA_H__
+
+#include "cpptest.h"
+#include "ibex_Agenda.h"
+#include "utils.h"
+
+using namespace ibex;
+
+class TestAgenda : public TestIbex {
+public:
+	TestAgenda() {
+		TEST_ADD(TestAgenda::fifo01);
+		TEST_ADD(TestAgenda::priority01);
+		TEST_ADD(TestAgenda::priority02);
+		TEST_ADD(TestAgenda::flush01);
+	}
+private:
+	void fifo01();
+	void priority01();
+	void priority02();
+	void flush01();
+};
+
+#endif // __TEST_AGENDA_H__
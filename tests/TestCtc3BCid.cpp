@@ -0,0 +1,250 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : TestCtc3BCid.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestCtc3BCid.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_EmptyBoxException.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+namespace ibex {
+
+namespace {
+
+// x^2+y^2+z^2=r^2, x*y=z, x+y=z+1
+System* sphere(double r=2) {
+	SystemFactory f;
+	Variable x,y,z;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_var(z);
+	f.add_ctr(sqr(x)+sqr(y)+sqr(z)=r*r);
+	f.add_ctr(x*y=z);
+	f.add_ctr(x+y=z+1);
+	return new System(f);
+}
+
+// The kth box of a 4x4x4 grid on [-2,2]^3 (k<64) or [-3,3]^3 (k=64)
+IntervalVector grid_box(int k) {
+	if (k==64) return IntervalVector(3,Interval(-3,3));
+	IntervalVector box(3);
+	for (int i=0; i<3; i++, k/=4)
+		box[i]=Interval(-2+k%4,-1+k%4);
+	return box;
+}
+
+/*
+ * Return true iff the parallel shaving gives exactly the same
+ * result as the sequential one on all the boxes of the grid.
+ */
+bool same_contraction(Ctc3BCid& seq, Ctc3BCid& par) {
+	for (int k=0; k<=64; k++) {
+		IntervalVector box=grid_box(k);
+		IntervalVector box2=box;
+		bool empty=false, empty2=false;
+
+		try { seq.contract(box); } catch (EmptyBoxException&) { empty=true; }
+		try { par.contract(box2); } catch (EmptyBoxException&) { empty2=true; }
+
+		if (empty!=empty2 || (!empty && box!=box2)) return false;
+	}
+	return true;
+}
+
+// Call the contractor on all the boxes of the grid and then 50
+// times on [-3,3]^3 (the first tuning phase of ACID is complete
+// after 50 calls that do not empty the box)
+void contract_grid(Ctc& c) {
+	for (int k=0; k<=64; k++) {
+		IntervalVector box=grid_box(k);
+		try { c.contract(box); } catch (EmptyBoxException&) { }
+	}
+	for (int k=0; k<50; k++) {
+		IntervalVector box=grid_box(64);
+		c.contract(box);
+	}
+}
+
+std::string read_file(const char* filename) {
+	std::ifstream f(filename);
+	std::stringstream s;
+	s << f.rdbuf();
+	return s.str();
+}
+
+// number of copies of the sub-contractor
+const int N=4;
+
+/*
+ * N copies of HC4, each built on its own copy
+ * of the system (the functions are not shared).
+ */
+class HC4Copies {
+public:
+	HC4Copies(const System& sys) : ctcs(N) {
+		for (int i=0; i<N; i++) {
+			copies[i]=new System(sys);
+			hc4[i]=new CtcHC4(*copies[i],0.1);
+			ctcs.set_ref(i,*hc4[i]);
+		}
+	}
+
+	~HC4Copies() {
+		for (int i=0; i<N; i++) {
+			delete hc4[i];
+			delete copies[i];
+		}
+	}
+
+	System* copies[N];
+	CtcHC4* hc4[N];
+	Array<Ctc> ctcs;
+};
+
+}
+
+void TestCtc3BCid::parallel01() {
+	System* sys=sphere();
+	CtcHC4 hc4(*sys,0.1);
+	Ctc3BCid seq(hc4);
+
+	HC4Copies clones(*sys);
+	Ctc3BCid par(hc4);
+	par.set_parallel(clones.ctcs);
+
+	TEST_ASSERT(same_contraction(seq,par));
+	delete sys;
+}
+
+void TestCtc3BCid::parallel02() {
+	// more slices and a CID on several slices
+	System* sys=sphere();
+	CtcHC4 hc4(*sys,0.1);
+	Ctc3BCid seq(hc4,16,5);
+
+	HC4Copies clones(*sys);
+	Ctc3BCid par(hc4,16,5);
+	par.set_parallel(clones.ctcs);
+
+	TEST_ASSERT(same_contraction(seq,par));
+	delete sys;
+}
+
+void TestCtc3BCid::parallel03() {
+	System* sys=sphere();
+	CtcHC4 hc4(*sys,0.1);
+	CtcAcid seq(*sys,hc4);
+
+	HC4Copies clones(*sys);
+	CtcAcid par(*sys,hc4);
+	par.set_parallel(clones.ctcs);
+
+	TEST_ASSERT(same_contraction(seq,par));
+	delete sys;
+}
+
+void TestCtc3BCid::tuning01() {
+	System* sys=sphere();
+	CtcHC4 hc4(*sys,0.1);
+	CtcAcid acid(*sys,hc4);
+	contract_grid(acid);
+	acid.save_tuning("acid1.tmp");
+
+	CtcAcid acid2(*sys,hc4);
+	TEST_ASSERT(acid2.load_tuning("acid1.tmp"));
+	acid2.save_tuning("acid2.tmp");
+
+	// nothing has been lost
+	TEST_ASSERT(read_file("acid1.tmp")==read_file("acid2.tmp"));
+
+	remove("acid1.tmp");
+	remove("acid2.tmp");
+	delete sys;
+}
+
+void TestCtc3BCid::tuning02() {
+	// same structure, other constants
+	System* sys=sphere(2);
+	System* sys2=sphere(3);
+	TEST_ASSERT(CtcAcid::structural_hash(*sys)==CtcAcid::structural_hash(*sys2));
+	// the hash does not depend on the platform
+	TEST_ASSERT(CtcAcid::structural_hash(*sys)==1179430934U);
+
+	CtcHC4 hc4(*sys,0.1);
+	CtcAcid acid(*sys,hc4);
+	contract_grid(acid);
+	acid.save_tuning("acid1.tmp");
+
+	CtcHC4 hc4_2(*sys2,0.1);
+	CtcAcid acid2(*sys2,hc4_2);
+	TEST_ASSERT(acid2.load_tuning("acid1.tmp"));
+
+	remove("acid1.tmp");
+	delete sys2;
+	delete sys;
+}
+
+void TestCtc3BCid::tuning03() {
+	// other structure
+	System* sys=sphere();
+	SystemFactory f;
+	Variable x,y,z;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_var(z);
+	f.add_ctr(sqr(x)+sqr(y)+sqr(z)=4);
+	f.add_ctr(x*z=y);
+	f.add_ctr(x+y=z+1);
+	System sys2(f);
+	TEST_ASSERT(CtcAcid::structural_hash(*sys)!=CtcAcid::structural_hash(sys2));
+
+	CtcHC4 hc4(*sys,0.1);
+	CtcAcid acid(*sys,hc4);
+	contract_grid(acid);
+	acid.save_tuning("acid1.tmp");
+
+	CtcHC4 hc4_2(sys2,0.1);
+	CtcAcid acid2(sys2,hc4_2);
+	TEST_ASSERT(!acid2.load_tuning("acid1.tmp"));
+
+	remove("acid1.tmp");
+	delete sys;
+}
+
+void TestCtc3BCid::tuning04() {
+	// missing or bad file: the default tuning is kept
+	System* sys=sphere();
+	CtcHC4 hc4(*sys,0.1);
+	CtcAcid acid(*sys,hc4);
+	TEST_ASSERT(!acid.load_tuning("acid_missing.tmp"));
+
+	std::ofstream f("acid1.tmp");
+	f << "SYSTEM " << CtcAcid::structural_hash(*sys) << "\nNB_VAR 3\nNBCIDVAR x";
+	f.close();
+	TEST_ASSERT(!acid.load_tuning("acid1.tmp"));
+
+	CtcAcid acid2(*sys,hc4);
+	contract_grid(acid);
+	contract_grid(acid2);
+	acid.save_tuning("acid1.tmp");
+	acid2.save_tuning("acid2.tmp");
+	TEST_ASSERT(read_file("acid1.tmp")==read_file("acid2.tmp"));
+
+	remove("acid1.tmp");
+	remove("acid2.tmp");
+	delete sys;
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : TestCtc3BCid.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_CTC_3BCID_H__
+#define __TEST_CTC_3BCID_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public TestIbex {
+public:
+	TestCtc3BCid() {
+		TEST_ADD(TestCtc3BCid::parallel01);
+		TEST_ADD(TestCtc3BCid::parallel02);
+		TEST_ADD(TestCtc3BCid::parallel03);
+		TEST_ADD(TestCtc3BCid::tuning01);
+		TEST_ADD(TestCtc3BCid::tuning02);
+		TEST_ADD(TestCtc3BCid::tuning03);
+		TEST_ADD(TestCtc3BCid::tuning04);
+	}
+
+	void parallel01();
+	void parallel02();
+	void parallel03();
+	void tuning01();
+	void tuning02();
+	void tuning03();
+	void tuning04();
+};
+
+} // end namespace ibex
+#endif // __TEST_CTC_3BCID_H__
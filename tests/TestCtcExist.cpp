@@ -54,4 +54,33 @@ void TestCtcExist::test01() {
 
 }
 
+void TestCtcExist::memo01() {
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+	double prec=1e-05;
+	NumConstraint c(f,LEQ);
+	CtcExist exist_y(c,y,IntervalVector(1,Interval(-10,10)),prec);
+	exist_y.memo=true;
+	exist_y.parallel=true;
+
+	IntervalVector box(1,Interval(-10,10));
+	RoundRobin rr(1e-03);
+	CellStack stack;
+	vector<IntervalVector> sols;
+	double right_bound=+0.3872983346072957;
+
+	Solver s(exist_y,rr,stack);
+	s.start(box);
+	s.next(sols);
+	TEST_ASSERT(sols.back()[0].contains(right_bound));
+
+	// all the solutions
+	while (s.next(sols)) { }
+	IntervalVector hull=IntervalVector::empty(1);
+	for (unsigned int i=0; i<sols.size(); i++) hull |= sols[i];
+	TEST_ASSERT(hull[0].contains(-right_bound));
+	TEST_ASSERT(hull[0].contains(right_bound));
+	TEST_ASSERT(hull[0].diam()<=2*right_bound+2e-03);
+}
+
 } // end namespace
@@ -24,12 +24,14 @@ public:
 	TestCtcExist() {
 
 		TEST_ADD(TestCtcExist::test01);
+		TEST_ADD(TestCtcExist::memo01);
 		//TEST_ADD(TestCtcExist::test02);
 		//TEST_ADD(TestCtcExist::test03);
 		//TEST_ADD(TestCtcExist::test04);
 	}
 
 	void test01();
+	void memo01();
 	//void test02();
 	//void test03();
 	//void test04();
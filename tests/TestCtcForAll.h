@@ -23,9 +23,11 @@ public:
 	TestCtcForAll() {
 
 		TEST_ADD(TestCtcForAll::test01);
+		TEST_ADD(TestCtcForAll::memo01);
 	}
 
 	void test01();
+	void memo01();
 };
 
 } // namespace ibex
@@ -12,7 +12,10 @@
 #include "Ponts30.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcFusedHC4.h"
 #include "ibex_Array.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_EmptyBoxException.h"
 
 namespace ibex {
 
@@ -55,4 +58,181 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::priority01() {
+	Ponts30 p30;
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+	}
+	Array<NumConstraint> a(ctr,30);
+
+	// with a tiny ratio, the FIFO and priority agendas
+	// reach the same fixpoint
+	CtcHC4 hc4(a,1e-12);
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+
+	CtcHC4 hc4_prio(a,1e-12);
+	hc4_prio.priority=true;
+	IntervalVector box2=p30.init_box;
+	hc4_prio.contract(box2);
+
+	TEST_ASSERT(box==box2);
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
+namespace {
+
+// x[0]=1, x[i]=x[i-1]+1 (i=1..n-1) [and x[n-1]=0 if inconsistent]
+System* chain(int n, bool inconsistent=false) {
+	SystemFactory f;
+	Variable x(n);
+	f.add_var(x);
+	f.add_ctr(x[0]=1);
+	for (int i=1; i<n; i++)
+		f.add_ctr(x[i]=x[i-1]+1);
+	if (inconsistent)
+		f.add_ctr(x[n-1]=0);
+	return new System(f);
+}
+
+}
+
+void TestCtcHC4::parallel01() {
+	System* sys=chain(20);
+	CtcHC4 hc4(*sys);
+	hc4.parallel=true;
+	IntervalVector box(20,Interval(-100,100));
+	hc4.contract(box);
+	for (int i=0; i<20; i++)
+		TEST_ASSERT(box[i]==Interval(i+1));
+	delete sys;
+}
+
+void TestCtcHC4::parallel02() {
+	System* sys=chain(20,true);
+	CtcHC4 hc4(*sys);
+	hc4.parallel=true;
+	IntervalVector box(20,Interval(-100,100));
+	bool empty=false;
+	try {
+		hc4.contract(box);
+	} catch (EmptyBoxException&) {
+		empty=true;
+	}
+	TEST_ASSERT(empty);
+	delete sys;
+}
+
+void TestCtcHC4::parallel03() {
+	Ponts30 p30;
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++) {
+		Function* fi=dynamic_cast<Function*>(&((*p30.f)[i]));
+		ctr[i]=new NumConstraint(*fi,EQ);
+	}
+	Array<NumConstraint> a(ctr,30);
+
+	// with a tiny ratio, the sequential and parallel
+	// propagations reach the same fixpoint
+	CtcHC4 hc4(a,1e-12);
+	IntervalVector box=p30.init_box;
+	hc4.contract(box);
+
+	CtcHC4 hc4_par(a,1e-12);
+	hc4_par.parallel=true;
+	IntervalVector box2=p30.init_box;
+	hc4_par.contract(box2);
+
+	TEST_ASSERT(almost_eq(box, box2, 1e-08));
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
+void TestCtcHC4::parallel04() {
+	System* sys=chain(20);
+
+	// x[0]=1 is enforced by a contractor with
+	// unspecified input variables (a propagation)
+	CtcHC4 first(Array<NumConstraint>(sys->ctrs[0]));
+	TEST_ASSERT(first.input==NULL);
+
+	Array<Ctc> l(20);
+	l.set_ref(0,first);
+	for (int i=1; i<20; i++)
+		l.set_ref(i,*new CtcFwdBwd(sys->ctrs[i]));
+
+	CtcPropag propag(l);
+	propag.parallel=true;
+	IntervalVector box(20,Interval(-100,100));
+	propag.contract(box);
+	for (int i=0; i<20; i++)
+		TEST_ASSERT(box[i]==Interval(i+1));
+
+	for (int i=1; i<20; i++)
+		delete &l[i];
+	delete sys;
+}
+
+void TestCtcHC4::fused01() {
+	System* sys=chain(20);
+	CtcFusedHC4 hc4(*sys);
+	IntervalVector box(20,Interval(-100,100));
+	hc4.contract(box);
+	for (int i=0; i<20; i++)
+		TEST_ASSERT(box[i]==Interval(i+1));
+	delete sys;
+}
+
+void TestCtcHC4::fused02() {
+	System* sys=chain(20,true);
+	CtcFusedHC4 hc4(*sys);
+	IntervalVector box(20,Interval(-100,100));
+	bool empty=false;
+	try {
+		hc4.contract(box);
+	} catch (EmptyBoxException&) {
+		empty=true;
+	}
+	TEST_ASSERT(empty);
+	TEST_ASSERT(box.is_empty());
+	delete sys;
+}
+
+void TestCtcHC4::fused03() {
+	// x^2+y^2=1, x^2=y, x>=0
+	SystemFactory fac;
+	Variable x,y;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(sqr(x)=y);
+	fac.add_ctr(x>=0);
+	System sys(fac);
+
+	CtcFusedHC4 fused(sys,1e-12);
+	// the subexpression x^2 is shared
+	int nb_nodes=0;
+	for (int i=0; i<sys.nb_ctr; i++)
+		nb_nodes+=sys.ctrs[i].f.nb_nodes();
+	TEST_ASSERT(fused.f.nb_nodes()<nb_nodes);
+
+	IntervalVector box(2,Interval(-10,10));
+	fused.contract(box);
+
+	IntervalVector box2(2,Interval(-10,10));
+	CtcHC4 hc4(sys,1e-12);
+	hc4.contract(box2);
+
+	// y=(sqrt(5)-1)/2, x=sqrt(y)
+	double yy=(::sqrt(5.0)-1)/2;
+	TEST_ASSERT(almost_eq(box, box2, 1e-08));
+	TEST_ASSERT(box[1].contains(yy));
+	TEST_ASSERT(box[0].contains(::sqrt(yy)));
+}
+
 } // end namespace ibex
@@ -20,9 +20,25 @@ class TestCtcHC4 : public TestIbex {
 public:
 	TestCtcHC4() {
 		TEST_ADD(TestCtcHC4::ponts30);
+		TEST_ADD(TestCtcHC4::priority01);
+		TEST_ADD(TestCtcHC4::parallel01);
+		TEST_ADD(TestCtcHC4::parallel02);
+		TEST_ADD(TestCtcHC4::parallel03);
+		TEST_ADD(TestCtcHC4::parallel04);
+		TEST_ADD(TestCtcHC4::fused01);
+		TEST_ADD(TestCtcHC4::fused02);
+		TEST_ADD(TestCtcHC4::fused03);
 	}
 
 	void ponts30();
+	void priority01();
+	void parallel01();
+	void parallel02();
+	void parallel03();
+	void parallel04();
+	void fused01();
+	void fused02();
+	void fused03();
 };
 
 } // end namespace ibex
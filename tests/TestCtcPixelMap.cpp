@@ -302,6 +302,76 @@ void TestCtcPixelMap::test2d_corner(){
 
 //}
 
+void TestCtcPixelMap::test2d_batch(){
+    PixelMap2D raster;
+    raster.set_leaf_size(0.1,0.1);
+    raster.set_origin(-2,1);
+    raster.set_grid_size(200,150);
+    srand(1);
+    for(int k = 0; k < 100; k++)
+        raster(rand()%200,rand()%150) = 1;
+    raster.compute_integral_image();
+
+    CtcPixelMap ctc(raster);
+    ctc.parallel = true;
+
+    std::vector<IntervalVector> boxes;
+    for(int k = 0; k < 500; k++){
+        double x = -3 + 23*((double) rand()/RAND_MAX);
+        double y = 0 + 17*((double) rand()/RAND_MAX);
+        double w = 4*((double) rand()/RAND_MAX);
+        double h = 4*((double) rand()/RAND_MAX);
+        double v_[2][2] = {{x,x+w},{y,y+h}};
+        boxes.push_back(IntervalVector(2,v_));
+    }
+    boxes.push_back(IntervalVector(2,Interval::EMPTY_SET));
+    boxes.push_back(IntervalVector(2,Interval::ALL_REALS));
+
+    std::vector<IntervalVector> res(boxes);
+    ctc.contract(res);
+
+    bool same = true;
+    for(unsigned int k = 0; k < boxes.size(); k++){
+        ctc.contract(boxes[k]);
+        same &= (boxes[k].is_empty()? res[k].is_empty() : boxes[k] == res[k]);
+    }
+    TEST_ASSERT(same);
+}
+
+void TestCtcPixelMap::test3d_batch(){
+    PixelMap3D raster;
+    raster.set_leaf_size(0.1,0.1,0.05);
+    raster.set_origin(-2,1,0);
+    raster.set_grid_size(40,30,50);
+    srand(1);
+    for(int k = 0; k < 50; k++)
+        raster(rand()%40,rand()%30,rand()%50) = 1;
+    raster.compute_integral_image();
+
+    CtcPixelMap ctc(raster);
+    ctc.parallel = true;
+
+    std::vector<IntervalVector> boxes;
+    for(int k = 0; k < 500; k++){
+        double x = -3 + 5*((double) rand()/RAND_MAX);
+        double y = 0 + 4*((double) rand()/RAND_MAX);
+        double z = -1 + 4*((double) rand()/RAND_MAX);
+        double w = ((double) rand()/RAND_MAX);
+        double v_[3][2] = {{x,x+w},{y,y+w},{z,z+w}};
+        boxes.push_back(IntervalVector(3,v_));
+    }
+
+    std::vector<IntervalVector> res(boxes);
+    ctc.contract(res);
+
+    bool same = true;
+    for(unsigned int k = 0; k < boxes.size(); k++){
+        ctc.contract(boxes[k]);
+        same &= (boxes[k].is_empty()? res[k].is_empty() : boxes[k] == res[k]);
+    }
+    TEST_ASSERT(same);
+}
+
 }
 
 
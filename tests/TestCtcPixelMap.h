@@ -20,6 +20,8 @@ public:
     TEST_ADD(TestCtcPixelMap::test2d_fullImage);
     TEST_ADD(TestCtcPixelMap::test2d_corner);
 
+    TEST_ADD(TestCtcPixelMap::test2d_batch);
+    TEST_ADD(TestCtcPixelMap::test3d_batch);
     }
 
 protected:
@@ -37,7 +39,9 @@ private:
     void test2d_allReal();
     void test2d_fullImage();
     void test2d_corner();
-    
+
+    void test2d_batch();
+    void test3d_batch();
 };
 //class TestCtcPixelMap : public Test::Suite {
 
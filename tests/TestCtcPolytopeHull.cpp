@@ -15,6 +15,7 @@
 #include "ibex_System.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxCombo.h"
+#include "ibex_LinearRelaxXTaylor.h"
 #include "ibex_Array.h"
 
 using namespace std;
@@ -63,5 +64,72 @@ void TestCtcPolytopeHull::fixbug01() {
 	check(box,box2);
 }
 
+void TestCtcPolytopeHull::parallel01() {
+	// x+y+z<=1, x-y<=0.5, -x+2z<=0.3
+	double _A[9]= {1,1,1,1,-1,0,-1,0,2};
+	Matrix A(3,3,_A);
+	double _b[3]= {1,0.5,0.3};
+	Vector b(3,_b);
+
+	CtcPolytopeHull seq(A,b);
+	CtcPolytopeHull par(A,b);
+	par.parallel=true;
+
+	IntervalVector box(3,Interval(-1,1));
+	IntervalVector box2(box);
+
+	seq.contract(box);
+	par.contract(box2);
+
+	TEST_ASSERT(box.is_strict_subset(IntervalVector(3,Interval(-1,1))));
+	TEST_ASSERT(almost_eq(box,box2,1e-8));
+
+	// next box: the copies of the linear program are updated
+	IntervalVector box3(3,Interval(0,1));
+	IntervalVector box4(box3);
+	seq.contract(box3);
+	par.contract(box4);
+	TEST_ASSERT(almost_eq(box3,box4,1e-8));
+}
+
+
+void TestCtcPolytopeHull::reuse01() {
+	// the rows of the linear program are overwritten
+	// from one box to the next (see LinearSolver).
+	SystemFactory f;
+	Variable x,y;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+	f.add_ctr(y>=sqr(x)-0.5);
+	System sys(f);
+
+	// deterministic corners
+	vector<LinearRelaxXTaylor::corner_point> cpoints;
+	cpoints.push_back(LinearRelaxXTaylor::INF_X);
+	cpoints.push_back(LinearRelaxXTaylor::SUP_X);
+
+	LinearRelaxXTaylor linear_relax(sys,cpoints);
+	CtcPolytopeHull polytope(linear_relax,CtcPolytopeHull::ALL_BOX);
+
+	double _boxes[][4] = {{-2,2,-2,2},{-1,0,-1,1},{0.5,0.6,-0.1,0.3},{-3,1,0,0.5},{-2,2,-2,2}};
+
+	for (int k=0; k<5; k++) {
+		double _box[][2] = {{_boxes[k][0],_boxes[k][1]},{_boxes[k][2],_boxes[k][3]}};
+		IntervalVector box(2,_box);
+		IntervalVector box2(box);
+
+		// a new linear program for each box
+		LinearRelaxXTaylor linear_relax2(sys,cpoints);
+		CtcPolytopeHull polytope2(linear_relax2,CtcPolytopeHull::ALL_BOX);
+
+		bool empty=false, empty2=false;
+		try { polytope.contract(box); } catch (EmptyBoxException&) { empty=true; }
+		try { polytope2.contract(box2); } catch (EmptyBoxException&) { empty2=true; }
+
+		TEST_ASSERT(empty==empty2);
+		if (!empty && !empty2) TEST_ASSERT(almost_eq(box,box2,1e-8));
+	}
+}
 
 } // end namespace ibex
@@ -19,18 +19,20 @@ class TestCtcPolytopeHull : public TestIbex {
 public:
 	TestCtcPolytopeHull() {
 
-#ifndef _IBEX_WITH_NOLP_
-
 		TEST_ADD(TestCtcPolytopeHull::lp01);
 		TEST_ADD(TestCtcPolytopeHull::fixbug01);
-
-#endif //_IBEX_WITH_NOLP_
+		TEST_ADD(TestCtcPolytopeHull::parallel01);
+		TEST_ADD(TestCtcPolytopeHull::reuse01);
 
 	}
 
 	void lp01();
 
 	void fixbug01();
+
+	void parallel01();
+
+	void reuse01();
 };
 
 } // end namespace ibex
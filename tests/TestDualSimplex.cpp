@@ -0,0 +1,101 @@
+//============================================================================
+//                                  I B E X
+// File        : TestDualSimplex.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestDualSimplex.h"
+#include "ibex_DualSimplex.h"
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * min -x-y s.t. x+2y<=4, 3x+y<=6, x,y in [0,10]
+ */
+static void init_lp(DualSimplex& lp) {
+	double a1[2]={1,2};
+	double a2[2]={3,1};
+	for (int j=0; j<2; j++) {
+		lp.set_obj(j,-1);
+		lp.set_bounds(j,0,10);
+	}
+	lp.add_row(a1,NEG_INFINITY,4);
+	lp.add_row(a2,NEG_INFINITY,6);
+}
+
+void TestDualSimplex::optimal01() {
+	DualSimplex lp(2);
+	init_lp(lp);
+
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	check(lp.obj_value(),-2.8);
+	check(lp.primal()[0],1.6);
+	check(lp.primal()[1],1.2);
+
+	// both constraints are active at their rhs
+	check(lp.dual()[0],-0.4);
+	check(lp.dual()[1],-0.2);
+	check(lp.reduced_costs()[0],0);
+	check(lp.reduced_costs()[1],0);
+}
+
+void TestDualSimplex::infeasible01() {
+	DualSimplex lp(2);
+	double a[2]={1,1};
+	for (int j=0; j<2; j++) {
+		lp.set_obj(j,1);
+		lp.set_bounds(j,0,1);
+	}
+	lp.add_row(a,3,POS_INFINITY);
+
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::INFEASIBLE);
+
+	// check the certificate with interval arithmetic
+	const double* r=lp.farkas();
+	Interval left(0);
+	for (int j=0; j<2; j++)
+		left += Interval(r[0])*a[j]*Interval(lp.lb(j),lp.ub(j));
+	Interval right=Interval(r[0])*Interval(lp.lhs(0),lp.rhs(0));
+	TEST_ASSERT((left & right).is_empty());
+}
+
+void TestDualSimplex::warm_start01() {
+	DualSimplex lp(2);
+	init_lp(lp);
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+
+	// same problem: the basis is already optimal
+	long iter=lp.nb_iter;
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	TEST_ASSERT(lp.nb_iter==iter);
+
+	// new objective (min -x)
+	lp.set_obj(1,0);
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	check(lp.obj_value(),-2);
+	check(lp.primal()[0],2);
+
+	// new bound (y>=1)
+	lp.set_bounds(1,1,10);
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	check(lp.obj_value(),-5.0/3);
+
+	// new rows
+	double a3[2]={1,0};
+	lp.add_row(a3,NEG_INFINITY,1);
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	check(lp.obj_value(),-1);
+
+	lp.remove_rows(2);
+	TEST_ASSERT(lp.nb_rows()==2);
+	TEST_ASSERT(lp.solve(100,10,1e-9)==DualSimplex::OPTIMAL);
+	check(lp.obj_value(),-5.0/3);
+}
+
+} // end namespace ibex
@@ -0,0 +1,34 @@
+//============================================================================
+//                                  I B E X
+// File        : TestDualSimplex.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_DUAL_SIMPLEX_H__
+#define __TEST_DUAL_SIMPLEX_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestDualSimplex : public TestIbex {
+public:
+	TestDualSimplex() {
+
+		TEST_ADD(TestDualSimplex::optimal01);
+		TEST_ADD(TestDualSimplex::infeasible01);
+		TEST_ADD(TestDualSimplex::warm_start01);
+
+	}
+
+	void optimal01();
+	void infeasible01();
+	void warm_start01();
+};
+
+} // end namespace ibex
+#endif // __TEST_DUAL_SIMPLEX_H__
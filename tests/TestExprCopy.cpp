@@ -11,6 +11,8 @@
 
 #include "TestExprCopy.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprShare.h"
+#include "ibex_Function.h"
 
 using namespace std;
 
@@ -35,4 +37,74 @@ void TestExprCopy::index_copy01() {
 	TEST_ASSERT(c->get_value()==Interval(0,1));
 }
 
+void TestExprCopy::share01() {
+	Variable x1,y1,x2,y2;
+	const ExprNode& e1=sqr(x1)+y1;
+	const ExprNode& e2=sqr(x2)-y2;
+
+	Array<const ExprSymbol> x(ExprSymbol::new_("x"),ExprSymbol::new_("y"));
+
+	ExprShare share;
+	const ExprAdd* c1=dynamic_cast<const ExprAdd*>(&share.copy(Array<const ExprSymbol>(x1,y1),x,e1));
+	const ExprSub* c2=dynamic_cast<const ExprSub*>(&share.copy(Array<const ExprSymbol>(x2,y2),x,e2));
+
+	TEST_ASSERT(c1 && c2);
+	TEST_ASSERT(&c1->left==&c2->left);
+	TEST_ASSERT(&c1->right==&x[1]);
+	TEST_ASSERT(&c2->right==&x[1]);
+
+	Function f(x,ExprVector::new_(*c1,*c2,false));
+	// nodes: x, y, x^2, x^2+y, x^2-y, (x^2+y,x^2-y)
+	TEST_ASSERT(f.nb_nodes()==6);
+
+	cleanup(Array<const ExprNode>(e1,e2),false);
+}
+
+void TestExprCopy::share02() {
+	Variable x1(2),x2(2);
+	const ExprNode& e1=x1[0]*x1[1];
+	const ExprNode& e2=x2[0]*x2[1]+x2[0];
+
+	Array<const ExprSymbol> x(ExprSymbol::new_("x",Dim::col_vec(2)));
+
+	ExprShare share;
+	const ExprNode& c1=share.copy(Array<const ExprSymbol>(x1),x,e1);
+	const ExprAdd* c2=dynamic_cast<const ExprAdd*>(&share.copy(Array<const ExprSymbol>(x2),x,e2));
+
+	TEST_ASSERT(c2);
+	TEST_ASSERT(&c2->left==&c1);
+	TEST_ASSERT(&c2->right==&((const ExprMul&) c1).left);
+
+	Function f(x,ExprVector::new_(c1,*c2,false));
+	// nodes: x, x[0], x[1], x[0]*x[1], x[0]*x[1]+x[0], vector
+	TEST_ASSERT(f.nb_nodes()==6);
+
+	cleanup(Array<const ExprNode>(e1,e2),false);
+}
+
+void TestExprCopy::share03() {
+	Variable a,b;
+	Function g(a,sqr(a));
+	Function h(b,exp(b));
+
+	Variable x1,x2;
+	const ExprNode& e1=g(x1)+h(x1);
+	const ExprNode& e2=g(x2)*h(x2);
+
+	Array<const ExprSymbol> x(ExprSymbol::new_("x"));
+
+	ExprShare share;
+	const ExprAdd* c1=dynamic_cast<const ExprAdd*>(&share.copy(Array<const ExprSymbol>(x1),x,e1));
+	const ExprMul* c2=dynamic_cast<const ExprMul*>(&share.copy(Array<const ExprSymbol>(x2),x,e2));
+
+	TEST_ASSERT(c1 && c2);
+	// applications of different functions are not merged
+	TEST_ASSERT(&c1->left!=&c1->right);
+	// applications of the same function are merged
+	TEST_ASSERT(&c1->left==&c2->left);
+	TEST_ASSERT(&c1->right==&c2->right);
+
+	cleanup(Array<const ExprNode>(e1,e2),false);
+}
+
 } // end namespace
@@ -23,11 +23,23 @@ public:
 	TestExprCopy() {
 
 		TEST_ADD(TestExprCopy::index_copy01);
+		TEST_ADD(TestExprCopy::share01);
+		TEST_ADD(TestExprCopy::share02);
+		TEST_ADD(TestExprCopy::share03);
 	}
 
 	// case where the vector is a constant vector
 	void index_copy01();
 
+	// common subexpression of two expressions
+	void share01();
+
+	// indexed symbols
+	void share02();
+
+	// applications of functions
+	void share03();
+
 };
 
 } // namespace ibex
@@ -399,6 +399,70 @@ void TestIntervalMatrix::mul02() {
 	TEST_ASSERT((m2*=m1).is_empty());
 }
 
+namespace {
+
+IntervalMatrix thick_matrix(int m, int n, double rad) {
+	IntervalMatrix M(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++)
+			M[i][j]=Interval(::sin(i+2*j+1.0)).inflate(rad);
+	return M;
+}
+
+}
+
+// real * interval: sharp
+void TestIntervalMatrix::mul_mid_rad01() {
+	int n=20;
+	Matrix C=thick_matrix(n,n,0).mid();
+	IntervalMatrix A=thick_matrix(n,n,0.1);
+
+	IntervalMatrix P=C*A;
+	IntervalMatrix Q=mul_mid_rad(C,A);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			TEST_ASSERT(Q[i][j].is_superset(P[i][j].mid()));
+			TEST_ASSERT_DELTA(Q[i][j].diam(),P[i][j].diam(),1e-10);
+		}
+}
+
+// interval * interval: enclosure and factor 1.5
+void TestIntervalMatrix::mul_mid_rad02() {
+	int n=20;
+	IntervalMatrix A=thick_matrix(n,n,0.1);
+	IntervalMatrix B=thick_matrix(n,n,0.2);
+
+	IntervalMatrix P=A*B;
+	IntervalMatrix Q=mul_mid_rad(A,B);
+
+	Matrix PR=A.random(1)*B.random(2);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) {
+			TEST_ASSERT(Q[i][j].contains(PR[i][j]));
+			TEST_ASSERT(Q[i][j].rad()<=1.5*P[i][j].rad()+1e-10);
+		}
+
+	IntervalMatrix E=IntervalMatrix::empty(n,n);
+	TEST_ASSERT(mul_mid_rad(E,B).is_empty());
+}
+
+// matrix-vector products
+void TestIntervalMatrix::mul_mid_rad03() {
+	int n=20;
+	IntervalMatrix A=thick_matrix(n,n,0.1);
+	IntervalVector x=thick_matrix(1,n,0.5)[0];
+
+	IntervalVector y=mul_mid_rad(A,x);
+	Vector yr=A.random(3)*x.random();
+	TEST_ASSERT(y.contains(yr));
+
+	// with a real matrix: the standard product, up to rounding
+	Matrix C=A.mid();
+	TEST_ASSERT(almost_eq(mul_mid_rad(C,x),C*x,1e-10));
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
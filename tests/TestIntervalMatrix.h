@@ -69,6 +69,9 @@ public:
 
 		TEST_ADD(TestIntervalMatrix::mul01);
 		TEST_ADD(TestIntervalMatrix::mul02);
+		TEST_ADD(TestIntervalMatrix::mul_mid_rad01);
+		TEST_ADD(TestIntervalMatrix::mul_mid_rad02);
+		TEST_ADD(TestIntervalMatrix::mul_mid_rad03);
 
 		TEST_ADD(TestIntervalMatrix::put01);
 	}
@@ -164,6 +167,12 @@ public:
 	void mul01();
 	void mul02();
 
+	// test:
+	//  mul_mid_rad(...)
+	void mul_mid_rad01();
+	void mul_mid_rad02();
+	void mul_mid_rad03();
+
 	void put01();
 };
 
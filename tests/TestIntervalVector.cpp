@@ -698,3 +698,33 @@ void TestIntervalVector::random02() {
 
 	TEST_ASSERT(b==r);
 }
+
+static IntervalVector elem_func_box() {
+	double _b[][2]={{-800,-700},{-1,2},{0.5,0.5},{0,1e-300},{1,1.5},{3,3.5},{5,100},{1e3,1e7},{1,POS_INFINITY},{NEG_INFINITY,-2}};
+	return IntervalVector(10,_b);
+}
+
+void TestIntervalVector::pow01() {
+	IntervalVector x=elem_func_box();
+	for (int p=-3; p<=3; p++) {
+		IntervalVector y=pow(x,p);
+		for (int i=0; i<x.size(); i++) {
+			if (p<0 && x[i].contains(0)) continue;
+			TEST_ASSERT(y[i].is_superset(pow(x[i],p)));
+		}
+	}
+}
+
+void TestIntervalVector::pow02() {
+	double _b[][2]={{1,2},{0,3},{-2,-1}};
+	IntervalVector x(3,_b);
+	x[1].set_empty();
+	for (int p=-2; p<=3; p++) {
+		IntervalVector y=pow(x,p);
+		TEST_ASSERT(y[0].is_superset(pow(x[0],p)));
+		TEST_ASSERT(y[1]==pow(x[1],p));
+		TEST_ASSERT(y[2].is_superset(pow(x[2],p)));
+		TEST_ASSERT(!y[0].is_empty());
+		TEST_ASSERT(!y[2].is_empty());
+	}
+}
@@ -117,6 +117,9 @@ public:
 
 		TEST_ADD(TestIntervalVector::random01);
 		TEST_ADD(TestIntervalVector::random02);
+
+		TEST_ADD(TestIntervalVector::pow01);
+		TEST_ADD(TestIntervalVector::pow02);
 	}
 
 	/* test:
@@ -264,6 +267,10 @@ public:
 	void random01();
 	void random02();
 
+	// test: component-wise elementary functions
+	void pow01();
+	void pow02();
+
 private:
 
 };
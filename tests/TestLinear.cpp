@@ -93,4 +93,94 @@ void TestLinear::inflating_gauss_seidel03() {
 	TEST_ASSERT(!ret);
 }
 
+namespace {
+
+// tridiagonal diagonally dominant matrix
+IntervalMatrix tridiag(int n) {
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(3.9,4.1);
+		if (i>0) A[i][i-1]=Interval(-1.1,-0.9);
+		if (i<n-1) A[i][i+1]=Interval(-1.1,-0.9);
+	}
+	return A;
+}
+
+}
+
+void TestLinear::sparse_gauss_seidel01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n);
+	SparseIntervalMatrix S(A);
+	TEST_ASSERT(S.nb_nonzeros()==3*n-2);
+	TEST_ASSERT(S.to_dense()==A);
+
+	IntervalVector b(n,Interval(0.9,1.1));
+	IntervalVector x1(n,Interval(-10,10));
+	IntervalVector x2(x1);
+
+	gauss_seidel(A,b,x1);
+	gauss_seidel(S,b,x2);
+	TEST_ASSERT(x1==x2);
+	TEST_ASSERT(x1.is_strict_subset(IntervalVector(n,Interval(-10,10))));
+}
+
+void TestLinear::sparse_precond01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n);
+	SparseIntervalMatrix S(A);
+	IntervalVector b(n,Interval(0.9,1.1));
+
+	precond(S,b,1);
+	// pattern is preserved
+	TEST_ASSERT(S.nb_nonzeros()==3*n-2);
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(S(i,i).contains(1.0));
+		TEST_ASSERT(almost_eq(b[i],Interval(0.9,1.1)/4.0,1e-10));
+	}
+}
+
+void TestLinear::sparse_precond02() {
+	int n=10;
+	IntervalMatrix A=tridiag(n);
+	IntervalVector b(n,Interval(0.9,1.1));
+	SparseIntervalMatrix S(A);
+	IntervalVector b2(b);
+
+	precond(A,b);
+	precond(S,b2,n);
+
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(almost_eq(S.to_dense()[i],A[i],1e-10));
+	}
+	TEST_ASSERT(almost_eq(b2,b,1e-10));
+}
+
+void TestLinear::precond_mid_rad01() {
+	int n=10;
+	IntervalMatrix A=tridiag(n);
+	IntervalVector b(n,Interval(0.9,1.1));
+	Matrix C(n,n);
+	precond_matrix(A,C);
+
+	IntervalMatrix A2(A);
+	IntervalVector b2(b);
+	precond(A,b);
+	precond(A2,b2,true);
+
+	// same enclosure as the standard products (up to rounding errors)
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(almost_eq(A2[i],A[i],1e-10));
+	}
+	TEST_ASSERT(almost_eq(b2,b,1e-10));
+
+	// the enclosure is valid: C*mid(A) and C*mid(b) are enclosed
+	IntervalMatrix CA=C*IntervalMatrix(tridiag(n).mid());
+	IntervalVector Cb=C*IntervalVector(n,Interval(1.0));
+	for (int i=0; i<n; i++) {
+		TEST_ASSERT(CA[i].is_subset(A2[i]));
+	}
+	TEST_ASSERT(Cb.is_subset(b2));
+}
+
 } // end namespace ibex
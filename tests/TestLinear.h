@@ -26,6 +26,10 @@ public:
 		TEST_ADD(TestLinear::inflating_gauss_seidel01);
 		TEST_ADD(TestLinear::inflating_gauss_seidel02);
 		TEST_ADD(TestLinear::inflating_gauss_seidel03);
+		TEST_ADD(TestLinear::sparse_gauss_seidel01);
+		TEST_ADD(TestLinear::sparse_precond01);
+		TEST_ADD(TestLinear::sparse_precond02);
+		TEST_ADD(TestLinear::precond_mid_rad01);
 	}
 
 	void lu_partial_underctr();
@@ -38,6 +42,15 @@ public:
 	void inflating_gauss_seidel02();
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
+
+	// sparse and dense Gauss-Seidel give the same result
+	void sparse_gauss_seidel01();
+	// block-diagonal preconditioning (1x1 blocks)
+	void sparse_precond01();
+	// block-diagonal preconditioning with a single block = dense preconditioning
+	void sparse_precond02();
+	// preconditioning with midpoint-radius products
+	void precond_mid_rad01();
 };
 
 } // end namespace ibex
@@ -11,6 +11,7 @@
 #include "TestNewton.h"
 #include "Ponts30.h"
 #include "ibex_Newton.h"
+#include "ibex_CtcNewton.h"
 #include "ibex_EmptyBoxException.h"
 #include "ibex_LinearException.h"
 
@@ -102,6 +103,73 @@ void TestNewton::newton01() {
 	TEST_ASSERT(almost_eq(box,expected,1e-10));
 }
 
+// Newton with a preconditioner computed once and reused
+void TestNewton::newton02() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	Matrix C(30,30);
+	bool update=true;
+	newton(*p30.f,C,update,box);
+	TEST_ASSERT(!update);
+
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+
+	// a smaller box containing the solution, with the same preconditioner
+	IntervalVector box2(30,BOX1);
+	box2 &= expected+IntervalVector(30,Interval(-1e-4,1e-4));
+	newton(*p30.f,C,update,box2);
+	TEST_ASSERT(!update);
+	TEST_ASSERT(almost_eq(box2,expected,1e-10));
+}
+
+// Newton with midpoint-radius preconditioning
+void TestNewton::newton_mid_rad01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	newton(*p30.f,box,default_newton_prec,default_gauss_seidel_ratio,true);
+
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+
+	CtcNewton ctc(*p30.f,1.0);
+	ctc.mid_rad=true;
+	IntervalVector box2(30,BOX1);
+	ctc.contract(box2);
+	TEST_ASSERT(almost_eq(box2,expected,1e-10));
+}
+
+void TestNewton::sparse_hansen01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+
+	IntervalMatrix H(30,30);
+	p30.f->hansen_matrix(box,H);
+
+	SparseIntervalMatrix S=p30.f->jacobian_structure();
+	TEST_ASSERT(S.density()<0.2);
+	p30.f->hansen_matrix(box,S);
+
+	TEST_ASSERT(S.to_dense()==H);
+}
+
+// Newton with the Jacobian matrix calculated in sparse format
+void TestNewton::sparse_newton01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+
+	double ratio=default_sparse_jacobian_ratio;
+	default_sparse_jacobian_ratio=1.0;
+	newton(*p30.f,box);
+	default_sparse_jacobian_ratio=ratio;
+
+	// the block-diagonal preconditioning is less effective
+	// than the dense one on this system (not block-diagonal)
+	IntervalVector expected(30,BOX2);
+	TEST_ASSERT(!box.is_disjoint(expected)); // both contain the solution
+	TEST_ASSERT(box.is_strict_subset(IntervalVector(30,BOX1)));
+}
+
 void TestNewton::inflating_newton01() {
 	Ponts30 p30;
 	double eps=1e-2;
@@ -114,4 +182,63 @@ void TestNewton::inflating_newton01() {
 	TEST_ASSERT(almost_eq(box,expected,1e-10));
 }
 
+void TestNewton::ctc_newton_reuse01() {
+	Ponts30 p30;
+	CtcNewton newton(*p30.f,1.0);
+	newton.reuse=true;
+
+	IntervalVector expected(30,BOX2);
+
+	IntervalVector box(30,BOX1);
+	newton.contract(box);
+	TEST_ASSERT(almost_eq(box,expected,1e-10));
+	TEST_ASSERT(newton.nb_reuse==0);
+
+	// a sub-box of the previous one: the preconditioner is reused
+	IntervalVector box2(30,BOX1);
+	box2 &= expected+IntervalVector(30,Interval(-1e-4,1e-4));
+	newton.contract(box2);
+	TEST_ASSERT(almost_eq(box2,expected,1e-10));
+	TEST_ASSERT(newton.nb_reuse==1);
+
+	// a box that is not included: a new preconditioner is computed
+	IntervalVector box3(30,BOX1);
+	box3.inflate(1e-4);
+	newton.contract(box3);
+	TEST_ASSERT(almost_eq(box3,expected,1e-10));
+	TEST_ASSERT(newton.nb_reuse==1);
+}
+
+namespace {
+
+// gives access to the cache of preconditioners
+class CtcNewtonCache : public CtcNewton {
+public:
+	CtcNewtonCache(const Fnc& f) : CtcNewton(f,1.0) { }
+	int cache_size() const { return cache.size(); }
+};
+
+}
+
+void TestNewton::ctc_newton_reuse02() {
+	Ponts30 p30;
+	CtcNewtonCache newton(*p30.f);
+	newton.reuse=true;
+	newton.reuse_ratio=2; // a preconditioner is never reused
+
+	// repeated calls on the same box
+	for (int i=0; i<10; i++) {
+		IntervalVector box(30,BOX1);
+		newton.contract(box);
+	}
+	TEST_ASSERT(newton.cache_size()==1);
+
+	// repeated calls on nested boxes
+	IntervalVector box(30,BOX1);
+	for (int i=0; i<10; i++)
+		newton.contract(box);
+	TEST_ASSERT(newton.cache_size()<=2);
+	TEST_ASSERT(newton.nb_reuse==0);
+}
+
 } // end namespace ibex
@@ -22,11 +22,25 @@ class TestNewton : public TestIbex {
 public:
 	TestNewton() {
 		TEST_ADD(TestNewton::newton01);
+		TEST_ADD(TestNewton::newton02);
+		TEST_ADD(TestNewton::newton_mid_rad01);
+		TEST_ADD(TestNewton::sparse_hansen01);
+		TEST_ADD(TestNewton::sparse_newton01);
 		TEST_ADD(TestNewton::inflating_newton01);
+		TEST_ADD(TestNewton::ctc_newton_reuse01);
+		TEST_ADD(TestNewton::ctc_newton_reuse02);
 	}
 
 	void newton01();
+	void newton02();
+	void newton_mid_rad01();
+	// sparse and dense Hansen matrices are equal
+	void sparse_hansen01();
+	void sparse_newton01();
 	void inflating_newton01();
+	void ctc_newton_reuse01();
+	// the cache of preconditioners does not grow on repeated calls
+	void ctc_newton_reuse02();
 };
 
 } // end namespace ibex
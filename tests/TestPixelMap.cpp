@@ -143,6 +143,146 @@ void TestPixelMap::test_ImageIntegral2D(){
 }
 
 
+void TestPixelMap::test_ImageIntegral3D(){
+    // a grid that is not a whole number of tiles
+    PixelMap3D raster;
+    raster.set_origin(0,0,0);
+    raster.set_leaf_size(1,1,1);
+    raster.set_grid_size(37,20,19);
+
+    srand(1);
+    for(uint i = 0; i < raster.data.size(); i++){
+        raster[i] = rand()%2;
+    }
+    PixelMap3D copy(raster);
+
+    raster.compute_integral_image();
+
+    // compare with the sum of the pixels of a few boxes
+    int corners[][3] = {{0,0,0},{15,15,15},{16,16,16},{36,19,18},{20,3,17}};
+    for(int c = 0; c < 5; c++){
+        unsigned int sum = 0;
+        for(int i = 0; i <= corners[c][0]; i++)
+            for(int j = 0; j <= corners[c][1]; j++)
+                for(int k = 0; k <= corners[c][2]; k++)
+                    sum += copy(i,j,k);
+        TEST_ASSERT(raster(corners[c][0],corners[c][1],corners[c][2]) == sum);
+    }
+}
+
+void TestPixelMap::test_readFormat_1_0_0(){
+    // write a file in the former format (pixels stored line by line)
+    std::ofstream out_file;
+    out_file.open("test.array2D_1_0_0", std::ios::out | std::ios::trunc | std::ios::binary);
+    out_file << "VERSION 1.0.0\nTYPE DATA_IMD_ND 2 4\nLEAF_SIZE 0.1 0.3\nORIGIN 0 2\nGRID_SIZE 70 3\nEND_HEADER\n";
+    for(unsigned int i = 0; i < 70*3; i++){
+        out_file.write((char*) &i, sizeof(unsigned int));
+    }
+    out_file.close();
+
+    PixelMap2D raster;
+    raster.load("test.array2D_1_0_0");
+    TEST_ASSERT(raster.grid_size_[0] == 70);
+    TEST_ASSERT(raster.grid_size_[1] == 3);
+    for(int i = 0; i < 70; i++){
+        for(int j = 0; j < 3; j++){
+            TEST_ASSERT(raster(i,j) == (unsigned int) i + 70*j);
+        }
+    }
+}
+
+void TestPixelMap::test_sharedMap(){
+    PixelMap2D raster;
+    raster.set_origin(0,0);
+    raster.set_leaf_size(1,1);
+    raster.set_grid_size(100,70);
+    raster(65,66) = 1;
+    raster.save("test.array2D_shared");
+
+    // a private mapping does not modify the file
+    PixelMap2D raster1;
+    raster1.load("test.array2D_shared");
+    raster1(1,1) = 2;
+
+    // a shared one does
+    PixelMap2D raster2;
+    raster2.load("test.array2D_shared",true);
+    TEST_ASSERT(raster2(1,1) == 0);
+    raster2.compute_integral_image();
+    raster2.load("test.array2D_shared");
+
+    TEST_ASSERT(raster2(64,69) == 0);
+    TEST_ASSERT(raster2(99,65) == 0);
+    TEST_ASSERT(raster2(65,66) == 1);
+    TEST_ASSERT(raster2(99,69) == 1);
+    TEST_ASSERT(raster1(1,1) == 2);
+}
+
+
+void TestPixelMap::test_updateIntegral2D(){
+    PixelMap2D raster;
+    raster.set_origin(0,0);
+    raster.set_leaf_size(1,1);
+    raster.set_grid_size(150,70);
+
+    srand(1);
+    for(uint i = 0; i < raster.data.size(); i++){
+        raster[i] = rand()%2;
+    }
+    PixelMap2D copy(raster);
+    raster.compute_integral_image();
+
+    // new occupancy of the sub-rectangle [60,100[ x [10,30[
+    unsigned int occupancy[40*20];
+    for(int j = 0; j < 20; j++)
+        for(int i = 0; i < 40; i++){
+            occupancy[i+40*j] = rand()%3;
+            copy(60+i,10+j) = occupancy[i+40*j];
+        }
+
+    raster.update_integral_image(60,10,40,20,occupancy);
+    copy.compute_integral_image();
+
+    bool same = true;
+    for(int j = 0; j < 70; j++)
+        for(int i = 0; i < 150; i++)
+            same &= (raster(i,j) == copy(i,j));
+    TEST_ASSERT(same);
+}
+
+void TestPixelMap::test_updateIntegral3D(){
+    PixelMap3D raster;
+    raster.set_origin(0,0,0);
+    raster.set_leaf_size(1,1,1);
+    raster.set_grid_size(37,20,19);
+
+    srand(1);
+    for(uint i = 0; i < raster.data.size(); i++){
+        raster[i] = rand()%2;
+    }
+    PixelMap3D copy(raster);
+    raster.compute_integral_image();
+
+    // new occupancy of the sub-box [10,30[ x [14,20[ x [5,8[
+    unsigned int occupancy[20*6*3];
+    for(int k = 0; k < 3; k++)
+        for(int j = 0; j < 6; j++)
+            for(int i = 0; i < 20; i++){
+                occupancy[i+20*(j+6*k)] = rand()%3;
+                copy(10+i,14+j,5+k) = occupancy[i+20*(j+6*k)];
+            }
+
+    raster.update_integral_image(10,14,5,20,6,3,occupancy);
+    copy.compute_integral_image();
+
+    bool same = true;
+    for(int k = 0; k < 19; k++)
+        for(int j = 0; j < 20; j++)
+            for(int i = 0; i < 37; i++)
+                same &= (raster(i,j,k) == copy(i,j,k));
+    TEST_ASSERT(same);
+}
+
 };
 
 
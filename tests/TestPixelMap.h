@@ -14,6 +14,11 @@ public:
         TEST_ADD(TestPixelMap::test_readWrongFileFormat_1);
         TEST_ADD(TestPixelMap::test_readWrongFileFormat_2);
         TEST_ADD(TestPixelMap::test_ImageIntegral2D);
+        TEST_ADD(TestPixelMap::test_ImageIntegral3D);
+        TEST_ADD(TestPixelMap::test_readFormat_1_0_0);
+        TEST_ADD(TestPixelMap::test_sharedMap);
+        TEST_ADD(TestPixelMap::test_updateIntegral2D);
+        TEST_ADD(TestPixelMap::test_updateIntegral3D);
     }
 
     void setup();    
@@ -23,6 +28,11 @@ public:
     void test_readWrongFileFormat_1();
     void test_readWrongFileFormat_2();
     void test_ImageIntegral2D();
+    void test_ImageIntegral3D();
+    void test_readFormat_1_0_0();
+    void test_sharedMap();
+    void test_updateIntegral2D();
+    void test_updateIntegral3D();
 
 
 };
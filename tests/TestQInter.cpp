@@ -0,0 +1,222 @@
+//============================================================================
+//                                  I B E X
+// File        : TestQInter.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "TestQInter.h"
+#include "ibex_QInter.h"
+#include "ibex_IncrQInter.h"
+#include "ibex_CtcQInter.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const int P=5;
+
+double _boxes[P][2][2] = {
+		{{0,4},{0,4}},
+		{{2,6},{1,5}},
+		{{3,8},{3,8}},
+		{{7,9},{0,1}},
+		{{5,6},{6,7}} };
+
+}
+
+void TestQInter::qinter01() {
+	Array<IntervalVector> boxes(P);
+	for (int i=0; i<P; i++)
+		boxes.set_ref(i,*new IntervalVector(2,_boxes[i]));
+
+	double _q1[][2]={{0,9},{0,8}};
+	double _q2[][2]={{2,6},{1,7}};
+	double _q3[][2]={{3,4},{3,4}};
+
+	for (int algo=0; algo<2; algo++) {
+		IntervalVector (*f)(const Array<IntervalVector>&, int) = algo==0? qinter : qinter2;
+		check(f(boxes,1),IntervalVector(2,_q1));
+		check(f(boxes,2),IntervalVector(2,_q2));
+		check(f(boxes,3),IntervalVector(2,_q3));
+		TEST_ASSERT(f(boxes,4).is_empty());
+	}
+
+	for (int i=0; i<P; i++)
+		delete &boxes[i];
+}
+
+void TestQInter::qinter02() {
+	// compare with the grid algorithm
+	// (on integer bounds, to have degenerated intersections)
+	srand(1);
+	for (int t=0; t<100; t++) {
+		int n=1+rand()%3;
+		int p=1+rand()%10;
+		int q=1+rand()%p;
+		Array<IntervalVector> boxes(p);
+		for (int i=0; i<p; i++) {
+			IntervalVector* b=new IntervalVector(n);
+			for (int j=0; j<n; j++) {
+				double l=rand()%6;
+				(*b)[j]=Interval(l,l+rand()%4);
+			}
+			boxes.set_ref(i,*b);
+		}
+		IntervalVector res=qinter(boxes,q);
+		TEST_ASSERT(qinter2(boxes,q)==res);
+		TEST_ASSERT(res.is_subset(qinter_projf(boxes,q)));
+
+		for (int i=0; i<p; i++)
+			delete &boxes[i];
+	}
+}
+
+void TestQInter::qinter_projf01() {
+	Array<IntervalVector> boxes(P);
+	for (int i=0; i<P; i++)
+		boxes.set_ref(i,*new IntervalVector(2,_boxes[i]));
+
+	// the 4th and 5th boxes are removed by the projections
+	double _q3[][2]={{3,4},{3,4}};
+	check(qinter_projf(boxes,3),IntervalVector(2,_q3));
+	TEST_ASSERT(qinter_projf(boxes,4).is_empty());
+
+	// the first two boxes intersect in [0,1]x[0,1], the last
+	// two ones in [2,3]x[2,3]
+	IntervalVector a(2,Interval(0,1));
+	IntervalVector b(2,Interval(2,3));
+	IntervalVector c(2); c[0]=Interval(0,1); c[1]=Interval(2,3);
+	IntervalVector d(2); d[0]=Interval(2,3); d[1]=Interval(0,1);
+	Array<IntervalVector> boxes2(a,a,b,b);
+	check(qinter_projf(boxes2,2),IntervalVector(2,Interval(0,3)));
+	check(qinter2(boxes2,2),IntervalVector(2,Interval(0,3)));
+
+	// the projections do not see that the q-intersection is empty
+	Array<IntervalVector> boxes3(a,b,c,d);
+	check(qinter_projf(boxes3,2),IntervalVector(2,Interval(0,3)));
+	TEST_ASSERT(qinter2(boxes3,2).is_empty());
+
+	for (int i=0; i<P; i++)
+		delete &boxes[i];
+}
+
+void TestQInter::ctc_qinter01() {
+	Variable x(2);
+	Function f(x,x);
+
+	Array<Ctc> ctc(P);
+	for (int i=0; i<P; i++)
+		ctc.set_ref(i,*new CtcFwdBwd(f,IntervalVector(2,_boxes[i])));
+
+	double _q3[][2]={{3,4},{3,4}};
+
+	for (int algo=CtcQInter::QINTER_GRID; algo<=CtcQInter::QINTER_PROJ; algo++) {
+		CtcQInter q(ctc,3,(CtcQInter::qinter_algo) algo);
+		IntervalVector box(2,Interval(0,10));
+		q.contract(box);
+		check(box,IntervalVector(2,_q3));
+	}
+
+	for (int i=0; i<P; i++)
+		delete &ctc[i];
+}
+
+void TestQInter::incr_qinter01() {
+	srand(1);
+	int n=2;
+	int p=10;
+	IncrQInter qboxes(n,p);
+	Array<IntervalVector> boxes(p);
+	for (int i=0; i<p; i++)
+		boxes.set_ref(i,*new IntervalVector(IntervalVector::empty(n)));
+
+	for (int t=0; t<200; t++) {
+		// modify one box
+		int i=rand()%p;
+		if (rand()%10==0)
+			boxes[i].set_empty();
+		else {
+			IntervalVector b(n);
+			for (int j=0; j<n; j++) {
+				double l=rand()%6;
+				b[j]=Interval(l,l+rand()%4);
+			}
+			boxes[i]=b;
+		}
+		qboxes.set(i,boxes[i]);
+
+		int q=1+rand()%4;
+		TEST_ASSERT(qboxes.projection(q)==qinter_projf(boxes,q));
+		TEST_ASSERT(qboxes.hull(q)==qinter2(boxes,q));
+	}
+
+	for (int i=0; i<p; i++)
+		delete &boxes[i];
+}
+
+void TestQInter::ctc_qinter_incr01() {
+	Variable x(2);
+	Function f(x,x);
+
+	Array<Ctc> ctc(P);
+	for (int i=0; i<P; i++)
+		ctc.set_ref(i,*new CtcFwdBwd(f,IntervalVector(2,_boxes[i])));
+
+	CtcQInter q(ctc,2);
+	CtcQInter qi(ctc,2,CtcQInter::QINTER_SWEEP,true);
+
+	// a sequence of nested boxes
+	double _box[][2]={{0,10},{0,10}};
+	IntervalVector box(2,_box);
+	for (int k=0; k<4; k++) {
+		IntervalVector box2(box);
+		q.contract(box);
+		qi.contract(box2);
+		TEST_ASSERT(box==box2);
+		box[k%2]=Interval(box[k%2].lb(),box[k%2].mid());
+	}
+	TEST_ASSERT(qi.nb_calls<q.nb_calls);
+
+	for (int i=0; i<P; i++)
+		delete &ctc[i];
+}
+
+void TestQInter::ctc_qinter_incr02() {
+	Variable x(2);
+	Function f(x,x);
+
+	Array<Ctc> ctc(P);
+	for (int i=0; i<P; i++)
+		ctc.set_ref(i,*new CtcFwdBwd(f,IntervalVector(2,_boxes[i])));
+
+	CtcQInter q(ctc,1);
+	CtcQInter qi(ctc,1,CtcQInter::QINTER_SWEEP,true);
+
+	// a box, its left half and then its right half
+	// (the 4th box is empty in the left half but
+	// not in the right one)
+	double _box[][2]={{0,10},{0,10}};
+	double _left[][2]={{0,5},{0,10}};
+	double _right[][2]={{5,10},{0,10}};
+	IntervalVector boxes[3] = { IntervalVector(2,_box), IntervalVector(2,_left), IntervalVector(2,_right) };
+
+	for (int k=0; k<3; k++) {
+		IntervalVector box(boxes[k]);
+		IntervalVector box2(boxes[k]);
+		q.contract(box);
+		qi.contract(box2);
+		TEST_ASSERT(box==box2);
+	}
+
+	for (int i=0; i<P; i++)
+		delete &ctc[i];
+}
+
+} // end namespace ibex
@@ -0,0 +1,42 @@
+//============================================================================
+//                                  I B E X
+// File        : TestQInter.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+//============================================================================
+
+#ifndef __TEST_Q_INTER_H__
+#define __TEST_Q_INTER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestQInter : public TestIbex {
+public:
+	TestQInter() {
+
+		TEST_ADD(TestQInter::qinter01);
+		TEST_ADD(TestQInter::qinter02);
+		TEST_ADD(TestQInter::qinter_projf01);
+		TEST_ADD(TestQInter::ctc_qinter01);
+		TEST_ADD(TestQInter::incr_qinter01);
+		TEST_ADD(TestQInter::ctc_qinter_incr01);
+		TEST_ADD(TestQInter::ctc_qinter_incr02);
+
+	}
+
+	void qinter01();
+	void qinter02();
+	void qinter_projf01();
+	void ctc_qinter01();
+	void incr_qinter01();
+	void ctc_qinter_incr01();
+	void ctc_qinter_incr02();
+};
+
+} // end namespace ibex
+#endif // __TEST_Q_INTER_H__
@@ -64,5 +64,69 @@ void TestSepPolygon::test_SepPolygon_03(){
 
 }
 
+void TestSepPolygon::test_PdcInPolygon(){
+
+    // the object in the middle is a hole (clockwise)
+    murs_xa.insert(murs_xa.end(), murs_xa2.begin(), murs_xa2.end());
+    murs_ya.insert(murs_ya.end(), murs_ya2.begin(), murs_ya2.end());
+    murs_xb.insert(murs_xb.end(), murs_xb2.begin(), murs_xb2.end());
+    murs_yb.insert(murs_yb.end(), murs_yb2.begin(), murs_yb2.end());
+
+    PdcInPolygon p(murs_xa, murs_ya, murs_xb, murs_yb);
+
+    double _x1[][2] = {{5,5},{0,0}};
+    TEST_ASSERT(p.test(IntervalVector(2,_x1))==YES);
+
+    double _x2[][2] = {{0,0},{0,0}};
+    TEST_ASSERT(p.test(IntervalVector(2,_x2))==NO);
+
+    double _x3[][2] = {{20,20},{0,0}};
+    TEST_ASSERT(p.test(IntervalVector(2,_x3))==NO);
+
+    // a vertex
+    double _x4[][2] = {{0,0},{5,5}};
+    TEST_ASSERT(p.test(IntervalVector(2,_x4))==MAYBE);
+
+    // at the height of a vertex
+    double _x5[][2] = {{-5,-5},{5,5}};
+    TEST_ASSERT(p.test(IntervalVector(2,_x5))==YES);
+}
+
+void TestSepPolygon::test_CtcPolygonBoundary(){
+
+    murs_xa.insert(murs_xa.end(), murs_xa2.begin(), murs_xa2.end());
+    murs_ya.insert(murs_ya.end(), murs_ya2.begin(), murs_ya2.end());
+    murs_xb.insert(murs_xb.end(), murs_xb2.begin(), murs_xb2.end());
+    murs_yb.insert(murs_yb.end(), murs_yb2.begin(), murs_yb2.end());
+
+    CtcPolygonBoundary c(murs_xa, murs_ya, murs_xb, murs_yb);
+
+    // the union of the contractors of all the segments
+    Array<Ctc> list(murs_xa.size());
+    for(unsigned int i=0; i<murs_xa.size(); i++) {
+        list.set_ref(i, *new CtcSegment(murs_xa[i],murs_ya[i],murs_xb[i],murs_yb[i]));
+    }
+    CtcUnion u(list);
+
+    srand(1);
+    bool same=true;
+    for(int k=0; k<200; k++) {
+        double x=-12+24.0*rand()/RAND_MAX;
+        double y=-12+24.0*rand()/RAND_MAX;
+        double w=4.0*rand()/RAND_MAX;
+        double _box[][2] = {{x,x+w},{y,y+w}};
+        IntervalVector box1(2,_box);
+        IntervalVector box2(2,_box);
+        try { c.contract(box1); } catch(EmptyBoxException&) { box1.set_empty(); }
+        try { u.contract(box2); } catch(EmptyBoxException&) { box2.set_empty(); }
+        same &= (box1.is_empty()? box2.is_empty() : box1==box2);
+    }
+    TEST_ASSERT(same);
+
+    for(int i=0; i<list.size(); i++) {
+        delete &list[i];
+    }
+}
+
 } // end namespace
 
@@ -15,6 +15,8 @@
 #include "ibex_SepPolygon.h"
 #include "ibex_SepNot.h"
 #include "ibex_SepInter.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcSegment.h"
 
 #include "utils.h"
 
@@ -27,12 +29,16 @@ public:
         TEST_ADD(TestSepPolygon::test_SepPolygon_01);
         TEST_ADD(TestSepPolygon::test_SepPolygon_02);
         TEST_ADD(TestSepPolygon::test_SepPolygon_03);
+        TEST_ADD(TestSepPolygon::test_PdcInPolygon);
+        TEST_ADD(TestSepPolygon::test_CtcPolygonBoundary);
 	}
 
     void setup();
     void test_SepPolygon_01();
     void test_SepPolygon_02();
     void test_SepPolygon_03();
+    void test_PdcInPolygon();
+    void test_CtcPolygonBoundary();
 
 private:
     vector<double> murs_xa,murs_xb,murs_ya,murs_yb;
@@ -10,6 +10,15 @@
 #include "TestSetInterval.h"
 #include "ibex_SetInterval.h"
 #include "ibex_SetLeaf.h"
+#include "ibex_SetIntervalCompact.h"
+#include "ibex_SepFwdBwd.h"
+#include "ibex_SetFile.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
 
 namespace ibex {
 
@@ -27,4 +36,326 @@ void TestSetInterval::diff01() {
 	TEST_ASSERT(leaf && leaf->status==__IBEX_UNK__);
 }
 
+namespace {
+
+string file_content(const char* filename) {
+	ifstream is(filename, ios::in | ios::binary);
+	stringstream ss;
+	ss << is.rdbuf();
+	return ss.str();
+}
+
+// true if the two sets are represented by the same tree
+bool same(const SetInterval& set1, const SetIntervalCompact& set2) {
+	((SetInterval&) set1).save("set.pointer");
+	set2.save("set.compact");
+	bool res=file_content("set.pointer")==file_content("set.compact");
+	remove("set.pointer");
+	remove("set.compact");
+	return res;
+}
+
+bool same(const SetInterval& set1, const SetInterval& set2) {
+	((SetInterval&) set1).save("set.pointer1");
+	((SetInterval&) set2).save("set.pointer2");
+	bool res=file_content("set.pointer1")==file_content("set.pointer2");
+	remove("set.pointer1");
+	remove("set.pointer2");
+	return res;
+}
+
+int nb_leaves;
+double leaves_volume;
+
+void count_leaves(const IntervalVector& box, BoolInterval status) {
+	nb_leaves++;
+	if (status==YES) leaves_volume+=box.volume();
+}
+
+// a ring around (1,0) and one copy of its separator per thread
+class Ring {
+public:
+	Ring(int n) : f(n), seps(n) {
+		for (int i=0; i<n; i++) {
+			const ExprSymbol& x=ExprSymbol::new_();
+			const ExprSymbol& y=ExprSymbol::new_();
+			f.set_ref(i, *new Function(x,y,sqr(x-1)+sqr(y)+0.2*x*y));
+			seps.set_ref(i, *new SepFwdBwd(f[i],Interval(1,4)));
+		}
+	}
+
+	~Ring() {
+		for (int i=0; i<f.size(); i++) {
+			delete &seps[i];
+			delete &f[i];
+		}
+	}
+
+	Array<Function> f;
+	Array<Sep> seps;
+};
+
+}
+
+void TestSetInterval::compact_contract() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	Function f(x,y,sqr(x)+sqr(y));
+	SepFwdBwd sep(f,Interval(1,4));
+
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.05);
+	SetIntervalCompact set2(box,0.05);
+	set1.contract(sep);
+	set2.contract(sep);
+	TEST_ASSERT(same(set1,set2));
+
+	Vector pt(2);
+	pt[0]=0.1;
+	pt[1]=0.2;
+	TEST_ASSERT(set1.dist(pt,true)==set2.dist(pt,true));
+	TEST_ASSERT(set1.dist(pt,false)==set2.dist(pt,false));
+
+	// conversion and file format
+	SetIntervalCompact set3(set1);
+	TEST_ASSERT(same(set1,set3));
+	set2.save("set.compact");
+	SetInterval set4("set.compact");
+	SetIntervalCompact set5("set.compact");
+	remove("set.compact");
+	TEST_ASSERT(same(set4,set2));
+	TEST_ASSERT(same(set4,set5));
+	TEST_ASSERT(set5.nb_nodes()==set2.nb_nodes());
+}
+
+void TestSetInterval::compact_sync() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	Function f(x,y,sqr(x-1)+sqr(y)-x*y);
+	SepFwdBwd sep(f,LEQ);
+
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.05,false);
+	SetIntervalCompact set2(box,0.05,false);
+	set1.sync(sep);
+	set2.sync(sep);
+	TEST_ASSERT(!set2.is_empty());
+	TEST_ASSERT(same(set1,set2));
+
+	// no set is both inside and outside
+	SepFwdBwd sep2(f,GEQ);
+	TEST_THROWS(set1.sync(sep2), NoSet);
+	TEST_THROWS(set2.sync(sep2), NoSet);
+	TEST_ASSERT(set1.is_empty());
+	TEST_ASSERT(set2.is_empty());
+}
+
+void TestSetInterval::compact_inter_union() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	const ExprSymbol& x2=ExprSymbol::new_();
+	const ExprSymbol& y2=ExprSymbol::new_();
+	Function f1(x,y,sqr(x)+sqr(y));
+	Function f2(x2,y2,sqr(x2-1)+sqr(y2-0.5));
+	SepFwdBwd sep1(f1,LEQ);
+	SepFwdBwd sep2(f2,LEQ);
+
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval a1(box,0.1), b1(box,0.1), c1(box,0.1);
+	SetIntervalCompact a2(box,0.1), b2(box,0.1), c2(box,0.1);
+	a1.contract(sep1);
+	a2.contract(sep1);
+	b1.contract(sep2);
+	b2.contract(sep2);
+	c1.contract(sep2);
+	c2.contract(sep2);
+
+	a1 &= b1;
+	a2 &= b2;
+	TEST_ASSERT(same(a1,a2));
+
+	c1 |= a1;
+	c2 |= a2;
+	TEST_ASSERT(same(c1,c2));
+}
+
+void TestSetInterval::parallel_sync() {
+	Ring ring(3);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.02,false);
+	SetInterval set2(box,0.02,false);
+	set1.sync(ring.seps[0]);
+	set2.sync(ring.seps);
+	TEST_ASSERT(same(set1,set2));
+}
+
+void TestSetInterval::parallel_contract() {
+	Ring ring(3);
+	IntervalVector box(2,Interval(-3,3));
+
+	SetInterval set1(box,0.02);
+	SetInterval set2(box,0.02);
+	set1.contract(ring.seps[0]);
+	set2.contract(ring.seps);
+	TEST_ASSERT(same(set1,set2));
+}
+
+void TestSetInterval::file_mapped() {
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	Function f(x,y,sqr(x)+sqr(y));
+	SepFwdBwd sep(f,Interval(1,4));
+
+	SetInterval set(IntervalVector(2,Interval(-3,3)),0.05);
+	set.contract(sep);
+	set.save("set.mapped");
+
+	SetFile file("set.mapped");
+	TEST_ASSERT(file.bounding_box()==IntervalVector(2,Interval(-3,3)));
+	TEST_ASSERT(file.eps()==0.05);
+
+	nb_leaves=0;
+	leaves_volume=0;
+	set.visit_leaves(count_leaves);
+	int n=nb_leaves;
+	double v=leaves_volume;
+
+	nb_leaves=0;
+	leaves_volume=0;
+	file.visit_leaves(count_leaves);
+	TEST_ASSERT(nb_leaves==n);
+	TEST_ASSERT(leaves_volume==v);
+	TEST_ASSERT((int) file.nb_nodes()==2*n-1);
+
+	Vector pt(2);
+	pt[0]=0.1;
+	pt[1]=0.2;
+	TEST_ASSERT(set.dist(pt,true)==file.dist(pt,true));
+	TEST_ASSERT(set.dist(pt,false)==file.dist(pt,false));
+	TEST_ASSERT(file.contains(pt)==NO);
+	pt[0]=1.5;
+	TEST_ASSERT(set.dist(pt,true)==file.dist(pt,true));
+	TEST_ASSERT(set.dist(pt,false)==file.dist(pt,false));
+	TEST_ASSERT(file.contains(pt)==YES);
+	pt[0]=4;
+	TEST_ASSERT(file.contains(pt)==MAYBE);
+
+	SetInterval set2("set.mapped");
+	remove("set.mapped");
+	TEST_ASSERT(same(set,set2));
+}
+
+void TestSetInterval::file_stream() {
+	IntervalVector box(2,Interval(0,2));
+
+	// [0,1]x[0,2] is IN, [1,2]x[0,1] is OUT
+	// and [1,2]x[1,2] is UNK
+	SetFileWriter w("set.stream", box, 0.1);
+	w.leaf(__IBEX_IN__);
+	w.leaf(__IBEX_OUT__);
+	w.leaf(__IBEX_UNK__);
+	w.bisect(1, 1.0);
+	w.bisect(0, 1.0);
+	w.close();
+
+	SetFile file("set.stream");
+	TEST_ASSERT(file.nb_nodes()==5);
+	TEST_ASSERT(file[file.root()].info==(1<<3 | __IBEX_UNK_IN_OUT__));
+
+	Vector pt(2);
+	pt[0]=0.5; pt[1]=0.5;
+	TEST_ASSERT(file.contains(pt)==YES);
+	pt[0]=1.5;
+	TEST_ASSERT(file.contains(pt)==NO);
+	pt[1]=1.5;
+	TEST_ASSERT(file.contains(pt)==MAYBE);
+	pt[0]=1; pt[1]=0.5; // on the boundary of IN and OUT leaves
+	TEST_ASSERT(file.contains(pt)==MAYBE);
+	pt[0]=0.5; pt[1]=1;
+	TEST_ASSERT(file.contains(pt)==YES);
+
+	pt[0]=1.5; pt[1]=0.5;
+	TEST_ASSERT(file.dist(pt,true)==0.5);
+
+	// the same tree is saved again
+	SetInterval set("set.stream");
+	set.save("set.stream2");
+	TEST_ASSERT(file_content("set.stream")==file_content("set.stream2"));
+	remove("set.stream");
+	remove("set.stream2");
+}
+
+void TestSetInterval::file_legacy() {
+	// file in the former format
+	ofstream os("set.legacy", ios::out | ios::trunc | ios::binary);
+	double eps=0.1;
+	int n=1;
+	double lb=0, ub=2, pt=1;
+	int var=0, leaf=-1;
+	NodeType in=__IBEX_IN__, out=__IBEX_OUT__;
+	os.write((char*) &eps, sizeof(double));
+	os.write((char*) &n, sizeof(int));
+	os.write((char*) &lb, sizeof(double));
+	os.write((char*) &ub, sizeof(double));
+	os.write((char*) &var, sizeof(int));
+	os.write((char*) &pt, sizeof(double));
+	os.write((char*) &leaf, sizeof(int));
+	os.write((char*) &in, sizeof(NodeType));
+	os.write((char*) &leaf, sizeof(int));
+	os.write((char*) &out, sizeof(NodeType));
+	os.close();
+
+	TEST_ASSERT(!SetFile::is_set_file("set.legacy"));
+
+	SetInterval set1("set.legacy");
+	SetIntervalCompact set2("set.legacy");
+	remove("set.legacy");
+	TEST_ASSERT(same(set1,set2));
+
+	Vector x(1);
+	x[0]=1.5;
+	TEST_ASSERT(set1.dist(x,true)==0.5);
+	TEST_ASSERT(set2.dist(x,true)==0.5);
+}
+
+void TestSetInterval::file_version1() {
+	// file in the version 1 of the format (no byte order mark)
+	ofstream os("set.v1", ios::out | ios::trunc | ios::binary);
+	char magic[8]="IBEXSET";
+	unsigned int version=1;
+	int n=1;
+	double eps=0.1, lb=0, ub=2;
+	os.write(magic, 8);
+	os.write((char*) &version, sizeof(unsigned int));
+	os.write((char*) &n, sizeof(int));
+	os.write((char*) &eps, sizeof(double));
+	os.write((char*) &lb, sizeof(double));
+	os.write((char*) &ub, sizeof(double));
+	SetFile::Node nodes[3];
+	memset(nodes, 0, sizeof(nodes));
+	nodes[0].info=__IBEX_IN__;
+	nodes[1].info=__IBEX_OUT__;
+	nodes[2].info=(1<<3) | __IBEX_UNK_IN_OUT__;
+	nodes[2].left=0;
+	nodes[2].pt=1;
+	os.write((char*) nodes, sizeof(nodes));
+	os.close();
+
+	SetFile file("set.v1");
+	remove("set.v1");
+	TEST_ASSERT(file.nb_nodes()==3);
+	TEST_ASSERT(file.eps()==0.1);
+
+	Vector x(1);
+	x[0]=0.5;
+	TEST_ASSERT(file.contains(x)==YES);
+	x[0]=1.5;
+	TEST_ASSERT(file.contains(x)==NO);
+	TEST_ASSERT(file.dist(x,true)==0.5);
+}
+
 } // end namespace ibex
@@ -19,9 +19,27 @@ class TestSetInterval : public TestIbex {
 public:
 	TestSetInterval() {
 		TEST_ADD(TestSetInterval::diff01);
+		TEST_ADD(TestSetInterval::compact_contract);
+		TEST_ADD(TestSetInterval::compact_sync);
+		TEST_ADD(TestSetInterval::compact_inter_union);
+		TEST_ADD(TestSetInterval::parallel_sync);
+		TEST_ADD(TestSetInterval::parallel_contract);
+		TEST_ADD(TestSetInterval::file_mapped);
+		TEST_ADD(TestSetInterval::file_stream);
+		TEST_ADD(TestSetInterval::file_legacy);
+		TEST_ADD(TestSetInterval::file_version1);
 	}
 
 	void diff01();
+	void compact_contract();
+	void compact_sync();
+	void compact_inter_union();
+	void parallel_sync();
+	void parallel_contract();
+	void file_mapped();
+	void file_stream();
+	void file_legacy();
+	void file_version1();
 };
 
 } // end namespace ibex
@@ -0,0 +1,163 @@
+/* ============================================================================
+ * I B E X - TestTube
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestTube.h"
+
+using namespace std;
+
+namespace {
+
+// tube with 13 slices: [i,i+1+i%3] for i=0..12
+Tube tube13() {
+	Tube x(0,13,1.0);
+	for (int i=0; i<x.size(); i++)
+		x.set(i,Interval(i,i+1+i%3));
+	return x;
+}
+
+Interval linear_hull(const Tube& x, int i1, int i2) {
+	Interval res(Interval::EMPTY_SET);
+	for (int i=i1; i<=i2; i++) res|=x[i];
+	return res;
+}
+
+// check that the tree of slices is up to date
+bool tree_ok(const Tube& x) {
+	for (int i1=0; i1<x.size(); i1++)
+		for (int i2=i1; i2<x.size(); i2++)
+			if (x.hull(i1,i2)!=linear_hull(x,i1,i2)) return false;
+	return x.max()==linear_hull(x,0,x.size()-1).ub() && x.min()==linear_hull(x,0,x.size()-1).lb();
+}
+
+Interval linear_integral(const Tube& x, int i1, int i2) {
+	Interval res(0,0);
+	for (int i=i1; i<=i2; i++) res+=x[i]*x.get_delta_t();
+	return res;
+}
+
+}
+
+void TestTube::hull01() {
+	Tube x=tube13();
+	for (int i1=0; i1<x.size(); i1++)
+		for (int i2=i1; i2<x.size(); i2++)
+			TEST_ASSERT(x.hull(i1,i2)==linear_hull(x,i1,i2));
+	TEST_ASSERT(x.max()==14);
+	TEST_ASSERT(x.min()==0);
+}
+
+void TestTube::set01() {
+	Tube x=tube13();
+	x.set(5,Interval(-10,100));
+	TEST_ASSERT(x[5]==Interval(-10,100));
+	TEST_ASSERT(x.hull(0,12)==Interval(-10,100));
+	TEST_ASSERT(x.hull(6,12)==Interval(6,14));
+	TEST_ASSERT(x.max()==100);
+	TEST_ASSERT(x.min()==-10);
+	for (int i1=0; i1<x.size(); i1++)
+		for (int i2=i1; i2<x.size(); i2++)
+			TEST_ASSERT(x.hull(i1,i2)==linear_hull(x,i1,i2));
+}
+
+void TestTube::at01() {
+	Tube x=tube13();
+	TEST_ASSERT(x.at(Interval(2.5,2.7))==x[2]);
+	TEST_ASSERT(x.at(Interval(2.5,5.5))==linear_hull(x,2,5));
+	TEST_ASSERT(x.at(Interval(3,5))==linear_hull(x,3,4));
+	TEST_ASSERT(x.at(Interval(0,13))==linear_hull(x,0,12));
+	TEST_ASSERT(x.at(7.5)==x[7]);
+}
+
+void TestTube::integral01() {
+	Tube x=tube13();
+	x*=0.1;
+	for (int i1=0; i1<x.size(); i1++)
+		for (int i2=i1; i2<x.size(); i2++) {
+			Interval i=x.integral(i1,i2);
+			Interval l=linear_integral(x,i1,i2);
+			// the sums are not computed in the same order
+			TEST_ASSERT(almost_eq(i,l,1e-12));
+			TEST_ASSERT(!(i&l).is_empty());
+		}
+	TEST_ASSERT(x.integral(3,3)==x[3]);
+}
+
+void TestTube::integral02() {
+	Tube x=tube13();
+	Tube p(x);
+	p.integral();
+	for (int i=0; i<x.size(); i++)
+		TEST_ASSERT(p[i]==linear_integral(x,0,i));
+}
+
+void TestTube::resample01() {
+	Tube x=tube13();
+	x.set_tF(12);
+	x.resample(3.0);
+	TEST_ASSERT(x.size()==4);
+	TEST_ASSERT(x.get_delta_t()==3.0);
+	for (int i=0; i<4; i++)
+		TEST_ASSERT(x[i]==linear_hull(tube13(),3*i,3*i+2));
+	TEST_ASSERT(x.integral(0,3)==linear_integral(x,0,3));
+}
+
+void TestTube::resample02() {
+	Tube x=tube13();
+	x.resample(0.5);
+	TEST_ASSERT(x.size()==26);
+	Tube y=tube13();
+	for (int i=0; i<26; i++)
+		TEST_ASSERT(x[i]==y[i/2]);
+}
+
+void TestTube::ctcIn01() {
+	Tube x=tube13();
+	x.ctcIn(4.0,Interval(4.5,20));
+	TEST_ASSERT(x[4]==Interval(4.5,6));
+	TEST_ASSERT(x.hull(4,4)==Interval(4.5,6));
+	x.ctcIn(Interval(0,3),Interval(1,2));
+	TEST_ASSERT(x[0]==Interval(1,1));
+	TEST_ASSERT(x[1]==Interval(1,2));
+	TEST_ASSERT(x[2]==Interval(2,2));
+	TEST_ASSERT(x.hull(0,2)==Interval(1,2));
+	TEST_ASSERT(x.min()==1);
+}
+
+void TestTube::mutators01() {
+	Tube y=tube13();
+	y+=Interval(-1,1);
+
+	Tube x=tube13();
+	x&=y;
+	TEST_ASSERT(tree_ok(x));
+	x|=y;
+	TEST_ASSERT(tree_ok(x));
+	x+=y;
+	TEST_ASSERT(tree_ok(x));
+	x-=2.5;
+	TEST_ASSERT(tree_ok(x));
+	x*=Interval(-1,2);
+	TEST_ASSERT(tree_ok(x));
+	x/=y+20.0;
+	TEST_ASSERT(tree_ok(x));
+	x=y.slices()+y.slices();
+	TEST_ASSERT(tree_ok(x));
+	x.set_t0(-2,Interval(0,1));
+	TEST_ASSERT(x.size()==15);
+	TEST_ASSERT(tree_ok(x));
+	x.set_tF(10);
+	TEST_ASSERT(tree_ok(x));
+	x.ctcPeriodic(3);
+	TEST_ASSERT(tree_ok(x));
+	x=-x;
+	TEST_ASSERT(tree_ok(x));
+	TEST_ASSERT(x[0]==Interval(-1,0));
+}
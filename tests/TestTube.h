@@ -0,0 +1,46 @@
+/* ============================================================================
+ * I B E X - TestTube
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_TUBE_H__
+#define __TEST_TUBE_H__
+
+#include "cpptest.h"
+#include "ibex_Tube.h"
+#include "utils.h"
+
+using namespace ibex;
+
+class TestTube : public TestIbex {
+public:
+	TestTube() {
+		TEST_ADD(TestTube::hull01);
+		TEST_ADD(TestTube::set01);
+		TEST_ADD(TestTube::at01);
+		TEST_ADD(TestTube::integral01);
+		TEST_ADD(TestTube::integral02);
+		TEST_ADD(TestTube::resample01);
+		TEST_ADD(TestTube::resample02);
+		TEST_ADD(TestTube::ctcIn01);
+		TEST_ADD(TestTube::mutators01);
+	}
+private:
+	void hull01();
+	void set01();
+	void at01();
+	void integral01();
+	void integral02();
+	void resample01();
+	void resample02();
+	void ctcIn01();
+	void mutators01();
+};
+
+#endif // __TEST_TUBE_H__
@@ -17,6 +17,7 @@
 #include "TestString.h"
 #include "TestBitSet.h"
 #include "TestSymbolMap.h"
+#include "TestAgenda.h"
 #include "TestPixelMap.h"
 
 // ================ arithmetic ===============
@@ -27,6 +28,7 @@
 #include "TestArith.h"
 #include "TestInnerArith.h"
 #include "TestAffine2.h"
+#include "TestTube.h"
 //#include "TestDomain.h"
 
 // ================ symbolic ===============
@@ -51,12 +53,17 @@
 // ================ numeric ===============
 #include "TestLinear.h"
 #include "TestNewton.h"
+#include "TestDualSimplex.h"
 
 // ================ predicates ===============
 #include "TestPdcHansenFeasibility.h"
 
+// ================ combinatorial ===============
+#include "TestQInter.h"
+
 // ================ contractor ===============
 #include "TestCtcHC4.h"
+#include "TestCtc3BCid.h"
 #include "TestCtcInteger.h"
 #include "TestCtcFwdBwd.h"
 #include "TestCtcNotIn.h"
@@ -74,6 +81,7 @@
 // ================ set ===============
 #include "TestSeparator.h"
 #include "TestSepPolygon.h"
+#include "TestSetInterval.h"
 
 
 using namespace std;
@@ -90,6 +98,7 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestString()));
     ts.add(auto_ptr<Test::Suite>(new TestBitSet()));
     ts.add(auto_ptr<Test::Suite>(new TestSymbolMap()));
+    ts.add(auto_ptr<Test::Suite>(new TestAgenda()));
     ts.add(auto_ptr<Test::Suite>(new TestPixelMap()));
 
     ts.add(auto_ptr<Test::Suite>(new TestInterval()));
@@ -101,6 +110,7 @@ int main() {
     //ts.add(auto_ptr<Test::Suite>(new TestDomain()));
 
     ts.add(auto_ptr<Test::Suite>(new TestAffine2()));
+    ts.add(auto_ptr<Test::Suite>(new TestTube()));
 
     ts.add(auto_ptr<Test::Suite>(new TestExpr()));
     ts.add(auto_ptr<Test::Suite>(new TestExprCopy()));
@@ -119,10 +129,14 @@ int main() {
 
     ts.add(auto_ptr<Test::Suite>(new TestLinear()));
     ts.add(auto_ptr<Test::Suite>(new TestNewton()));
+    ts.add(auto_ptr<Test::Suite>(new TestDualSimplex()));
 
     ts.add(auto_ptr<Test::Suite>(new TestPdcHansenFeasibility()));
 
+    ts.add(auto_ptr<Test::Suite>(new TestQInter()));
+
     ts.add(auto_ptr<Test::Suite>(new TestCtcHC4()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtc3BCid()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcInteger()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcFwdBwd()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcNotIn()));
@@ -137,6 +151,7 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestOptimizer()));
     ts.add(auto_ptr<Test::Suite>(new TestSeparator()));
     ts.add(auto_ptr<Test::Suite>(new TestSepPolygon()));
+    ts.add(auto_ptr<Test::Suite>(new TestSetInterval()));
 
 
 